@@ -78,9 +78,11 @@ static A68_INFO info_text[] = {
   {"options", "--backtrace, --nobacktrace", "switch stack backtracing in case of a runtime error"},
   {"options", "--boldstropping", "set stropping mode to bold stropping"},
   {"options", "--brackets", "consider [ .. ] and { .. } as equivalent to ( .. )"},
+  {"options", "--cache, --nocache", "switch reuse of cached compiled plugins on or off"},
   {"options", "--check, --norun", "check syntax only, interpreter does not start"},
   {"options", "--clock", "report execution time excluding compilation time"},
   {"options", "--compile", "compile source file"},
+  {"options", "--executable", "compile source file into a standalone executable"},
   {"options", "--debug, --monitor", "start execution in the debugger and debug in case of runtime error"},
   {"options", "--echo string", "echo \"string\" to standard output"},
   {"options", "--execute unit", "execute algol 68 unit \"unit\""},
@@ -90,8 +92,10 @@ static A68_INFO info_text[] = {
   {"options", "--frame \"number\"", "set frame stack size to \"number\""},
   {"options", "--handles \"number\"", "set handle space size to \"number\""},
   {"options", "--heap \"number\"", "set heap size to \"number\""},
+  {"options", "--heaplimit \"number\"", "let the heap grow up to \"number\", 0 keeps it at its initial size"},
   {"options", "--keep, --nokeep", "switch object file deletion off or on"},
   {"options", "--listing", "make concise listing"},
+  {"options", "--mmap, --nommap", "switch mapping of files that are read into memory on or off"},
   {"options", "--moids", "make overview of moids in listing file"},
   {"options", "-O0, -O1, -O2, -O3", "switch compilation on and pass option to back-end C compiler"},
   {"options", "--optimise, --nooptimise", "switch compilation on or off"},
@@ -104,6 +108,7 @@ static A68_INFO info_text[] = {
   {"options", "--print unit", "print value yielded by algol 68 unit \"unit\""},
   {"options", "--quiet", "suppresses all warning diagnostics"},
   {"options", "--quotestropping", "set stropping mode to quote stropping"},
+  {"options", "--readbuffer \"number\"", "set size of read-ahead buffers for files to \"number\""},
   {"options", "--reductions", "print parser reductions"},
   {"options", "--run", "override --check/--norun options"},
   {"options", "--rerun", "run using already compiled code"},
@@ -119,6 +124,7 @@ static A68_INFO info_text[] = {
   {"options", "--verbose", "inform on program actions"},
   {"options", "--version", "state version of the running copy"},
   {"options", "--warnings, --nowarnings", "switch warning diagnostics on or off"},
+  {"options", "--writebuffer \"number\"", "set size of write buffers for files to \"number\""},
   {"options", "--xref, --noxref", "switch cross reference in the listing file on or off"},
   {NO_TEXT, NO_TEXT, NO_TEXT}
 };
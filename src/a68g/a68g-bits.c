@@ -57,15 +57,15 @@ void genie_sigsegv (NODE_T *p)
 
 void stack_backtrace (void)
 {
-#define DEPTH 16
-  void *array[DEPTH];
+#define BACKTRACE_DEPTH 16
+  void *array[BACKTRACE_DEPTH];
   WRITE_TXT (2, "\n++++ Top of call stack:");
-  int size = backtrace (array, DEPTH);
+  int size = backtrace (array, BACKTRACE_DEPTH);
   if (size > 0) {
     WRITE_TXT (2, "\n");
     backtrace_symbols_fd (array, size, 2);
   }
-#undef DEPTH
+#undef BACKTRACE_DEPTH
 }
 
 void genie_backtrace (NODE_T *p)
@@ -60,6 +60,7 @@ char get_stdin_char (void)
 
 char *read_string_from_tty (char *prompt)
 {
+  flush_write_buffers ();
 #if defined (HAVE_READLINE)
   char *line = readline (prompt);
   if (line != NO_TEXT && (int) strlen (line) > 0) {
@@ -100,6 +101,10 @@ char *read_string_from_tty (char *prompt)
 void io_write_string (FILE_T f, const char *z)
 {
   ssize_t j;
+  if (f == STDOUT_FILENO || f == STDERR_FILENO) {
+// Keep buffered program output and messages in order.
+    flush_write_buffers ();
+  }
   errno = 0;
   if (f != STDOUT_FILENO && f != STDERR_FILENO) {
 // Writing to file.
@@ -170,6 +175,28 @@ ssize_t io_read (FILE_T fd, void *buf, size_t n)
   return (ssize_t) n - (ssize_t) to_do; // return >= 0
 }
 
+//! @brief Read at most n bytes from file into buffer, return when some are available.
+
+ssize_t io_read_some (FILE_T fd, void *buf, size_t n)
+{
+  int restarts = 0;
+  while (A68_TRUE) {
+#if defined (BUILD_WIN32)
+    int bytes_read;
+#else
+    ssize_t bytes_read;
+#endif
+    errno = 0;
+    bytes_read = read (fd, buf, n);
+    if (bytes_read >= 0) {
+      return (ssize_t) bytes_read;      // 0 is EOF_CHAR
+    } else if (errno != EINTR || restarts++ > MAX_RESTART) {
+// read error.
+      return -1;
+    }
+  }
+}
+
 //! @brief Writes n bytes from buffer to file.
 
 ssize_t io_write (FILE_T fd, const void *buf, size_t n)
@@ -60,6 +60,27 @@ void default_mem_sizes (int n)
 #undef SET_SIZE
 }
 
+//! @brief Set default size up to which the heap may grow.
+
+void default_heap_limit (void)
+{
+// Default is a multiple of the initial heap, but no more than physical memory.
+// It is set when the heap is initialised, as options and pragmats may set the heap size.
+  if (A68 (heap_limit_set)) {
+    return;
+  }
+  A68 (heap_limit) = HEAP_LIMIT_FACTOR * (ADDR_T) A68_ALIGN (A68 (heap_size));
+#if defined (_SC_PHYS_PAGES) && defined (_SC_PAGESIZE)
+  long pages = sysconf (_SC_PHYS_PAGES), page = sysconf (_SC_PAGESIZE);
+  if (pages > 0 && page > 0) {
+    REAL_T mem = (REAL_T) pages * (REAL_T) page;
+    if (mem < (REAL_T) A68 (heap_limit)) {
+      A68 (heap_limit) = (ADDR_T) mem;
+    }
+  }
+#endif
+}
+
 //! @brief Read options from the .rc file.
 
 void read_rc_options (void)
@@ -164,19 +185,23 @@ void default_options (MODULE_T * p)
   OPTION_INDENT (p) = 2;
   OPTION_KEEP (p) = A68_FALSE;
   OPTION_LICENSE (p) = A68_FALSE;
+  OPTION_MAP_INPUT (p) = A68_FALSE;
   OPTION_MOID_LISTING (p) = A68_FALSE;
   OPTION_NODEMASK (p) = (STATUS_MASK_T) (ASSERT_MASK | SOURCE_MASK);
   OPTION_NO_WARNINGS (p) = A68_FALSE;
   OPTION_OPT_LEVEL (p) = NO_OPTIMISE;
+  OPTION_PLUGIN_CACHE (p) = A68_TRUE;
   OPTION_PORTCHECK (p) = A68_FALSE;
   OPTION_PRAGMAT_SEMA (p) = A68_TRUE;
   OPTION_PRETTY (p) = A68_FALSE;
   OPTION_QUIET (p) = A68_FALSE;
+  OPTION_READ_BUFFER (p) = DEFAULT_READ_BUFFER_SIZE;
   OPTION_REDUCTIONS (p) = A68_FALSE;
   OPTION_REGRESSION_TEST (p) = A68_FALSE;
   OPTION_RERUN (p) = A68_FALSE;
   OPTION_RUN (p) = A68_FALSE;
   OPTION_RUN_SCRIPT (p) = A68_FALSE;
+  OPTION_EXECUTABLE (p) = A68_FALSE;
   OPTION_SOURCE_LISTING (p) = A68_FALSE;
   OPTION_STANDARD_PRELUDE_LISTING (p) = A68_FALSE;
   OPTION_STATISTICS_LISTING (p) = A68_FALSE;
@@ -188,6 +213,7 @@ void default_options (MODULE_T * p)
   OPTION_UNUSED (p) = A68_FALSE;
   OPTION_VERBOSE (p) = A68_FALSE;
   OPTION_VERSION (p) = A68_FALSE;
+  OPTION_WRITE_BUFFER (p) = DEFAULT_WRITE_BUFFER_SIZE;
   set_long_mp_digits (0);
 }
 
@@ -299,9 +325,9 @@ void prune_echoes (OPTION_LIST_T * i)
   }
 }
 
-//! @brief Translate integral option argument.
+//! @brief Translate integral option argument that may exceed 2 GB.
 
-int fetch_integral (char *p, OPTION_LIST_T ** i, BOOL_T * error)
+INT_T fetch_long_integral (char *p, OPTION_LIST_T ** i, BOOL_T * error)
 {
   LINE_T *start_l = LINE (*i);
   char *start_c = STR (*i);
@@ -331,7 +357,7 @@ int fetch_integral (char *p, OPTION_LIST_T ** i, BOOL_T * error)
   } else {
     char *suffix;
     errno = 0;
-    k = (int) strtol (num, &suffix, 0); // Accept also octal and hex
+    k = (INT_T) strtol (num, &suffix, 0); // Accept also octal and hex
     *error = (BOOL_T) (suffix == num);
     if (errno != 0 || *error) {
       option_error (start_l, start_c, "conversion error in");
@@ -379,14 +405,29 @@ int fetch_integral (char *p, OPTION_LIST_T ** i, BOOL_T * error)
         }
       }
     }
-    if (OVER_2G ((REAL_T) k * (REAL_T) mult)) {
+    if ((REAL_T) k * (REAL_T) mult > (REAL_T) A68_MAX_INT) {
       errno = ERANGE;
-      option_error (start_l, start_c, ERROR_OVER_2G);
+      option_error (start_l, start_c, "conversion error in");
+      return 0;
     }
     return k * mult;
   }
 }
 
+//! @brief Translate integral option argument.
+
+int fetch_integral (char *p, OPTION_LIST_T ** i, BOOL_T * error)
+{
+  LINE_T *start_l = LINE (*i);
+  char *start_c = STR (*i);
+  INT_T k = fetch_long_integral (p, i, error);
+  if (OVER_2G (k)) {
+    errno = ERANGE;
+    option_error (start_l, start_c, ERROR_OVER_2G);
+  }
+  return (int) k;
+}
+
 //! @brief Process options gathered in the option list.
 
 BOOL_T set_options (OPTION_LIST_T * i, BOOL_T cmd_line)
@@ -702,6 +743,37 @@ BOOL_T set_options (OPTION_LIST_T * i, BOOL_T cmd_line)
             }
           }
         }
+// HEAPLIMIT sets the size up to which the heap may grow; 0 keeps it at HEAP.
+        else if (eq (p, "HEAPLimit") || eq (p, "HEAP-Limit")) {
+          BOOL_T error = A68_FALSE;
+          INT_T k = fetch_long_integral (p, &i, &error);
+          if (error || errno > 0) {
+            option_error (start_l, start_c, "conversion error in");
+          } else {
+            A68 (heap_limit) = (ADDR_T) k;
+            A68 (heap_limit_set) = A68_TRUE;
+          }
+        }
+// READBUFFER sets the size of read-ahead buffers for files.
+        else if (eq (p, "READBuffer") || eq (p, "READ-Buffer")) {
+          BOOL_T error = A68_FALSE;
+          int k = fetch_integral (p, &i, &error);
+          if (error || errno > 0) {
+            option_error (start_l, start_c, "conversion error in");
+          } else {
+            OPTION_READ_BUFFER (&A68_JOB) = k;
+          }
+        }
+// WRITEBUFFER sets the size of write buffers for files.
+        else if (eq (p, "WRITEBuffer") || eq (p, "WRITE-Buffer")) {
+          BOOL_T error = A68_FALSE;
+          int k = fetch_integral (p, &i, &error);
+          if (error || errno > 0) {
+            option_error (start_l, start_c, "conversion error in");
+          } else {
+            OPTION_WRITE_BUFFER (&A68_JOB) = k;
+          }
+        }
 // COMPILE and NOCOMPILE switch on/off compilation.
         else if (eq (p, "Compile")) {
 #if defined (BUILD_LINUX) || defined (BUILD_BSD)
@@ -716,8 +788,23 @@ BOOL_T set_options (OPTION_LIST_T * i, BOOL_T cmd_line)
 #endif
         } else if (eq (p, "NOCompile") || eq (p, "NO-Compile")) {
           OPTION_COMPILE (&A68_JOB) = A68_FALSE;
+          OPTION_EXECUTABLE (&A68_JOB) = A68_FALSE;
           OPTION_RUN_SCRIPT (&A68_JOB) = A68_FALSE;
         }
+// EXECUTABLE compiles into a standalone executable instead of a script.
+        else if (eq (p, "EXECUTABLE")) {
+#if defined (BUILD_LINUX)
+          OPTION_COMPILE (&A68_JOB) = A68_TRUE;
+          OPTION_COMPILE_CHECK (&A68_JOB) = A68_TRUE;
+          OPTION_EXECUTABLE (&A68_JOB) = A68_TRUE;
+          if (OPTION_OPT_LEVEL (&A68_JOB) < OPTIMISE_1) {
+            OPTION_OPT_LEVEL (&A68_JOB) = OPTIMISE_1;
+          }
+          OPTION_RUN_SCRIPT (&A68_JOB) = A68_FALSE;
+#else
+          option_error (start_l, start_c, "linux-only option");
+#endif
+        }
 // OPTIMISE and NOOPTIMISE switch on/off optimisation.
         else if (eq (p, "NOOptimize") || eq (p, "NO-Optimize")) {
           OPTION_OPT_LEVEL (&A68_JOB) = NO_OPTIMISE;
@@ -798,6 +885,14 @@ BOOL_T set_options (OPTION_LIST_T * i, BOOL_T cmd_line)
             OPTION_OPT_LEVEL (&A68_JOB) = OPTIMISE_1;
           }
         }
+// CACHE and NOCACHE switch on/off the cache of compiled plugins.
+        else if (eq (p, "CACHE")) {
+          OPTION_PLUGIN_CACHE (&A68_JOB) = A68_TRUE;
+        } else if (eq (p, "NOCACHE")) {
+          OPTION_PLUGIN_CACHE (&A68_JOB) = A68_FALSE;
+        } else if (eq (p, "NO-CACHE")) {
+          OPTION_PLUGIN_CACHE (&A68_JOB) = A68_FALSE;
+        }
 // KEEP and NOKEEP switch off/on object file deletion.
         else if (eq (p, "KEEP")) {
           OPTION_KEEP (&A68_JOB) = A68_TRUE;
@@ -1004,6 +1099,14 @@ BOOL_T set_options (OPTION_LIST_T * i, BOOL_T cmd_line)
         } else if (eq (p, "NO-OBJECT")) {
           OPTION_OBJECT_LISTING (&A68_JOB) = A68_FALSE;
         }
+// MMAP and NOMMAP switch on/off mapping of files that are read.
+        else if (eq (p, "MMAP")) {
+          OPTION_MAP_INPUT (&A68_JOB) = A68_TRUE;
+        } else if (eq (p, "NOMMAP")) {
+          OPTION_MAP_INPUT (&A68_JOB) = A68_FALSE;
+        } else if (eq (p, "NO-MMAP")) {
+          OPTION_MAP_INPUT (&A68_JOB) = A68_FALSE;
+        }
 // MOIDS prints an overview of moids used in the program.
         else if (eq (p, "MOIDS")) {
           OPTION_MOID_LISTING (&A68_JOB) = A68_TRUE;
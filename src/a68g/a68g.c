@@ -295,11 +295,13 @@ void compiler_interpreter (void)
   A68 (f_entry) = NO_NODE;
   A68 (global_level) = 0;
   A68 (max_lex_lvl) = 0;
+  A68 (display) = NO_VAR;
   A68_PARSER (stop_scanner) = A68_FALSE;
   A68_PARSER (read_error) = A68_FALSE;
   A68_PARSER (no_preprocessing) = A68_FALSE;
   A68_PARSER (reductions) = 0;
   A68_PARSER (tag_number) = 0;
+  init_tag_index ();
   A68 (curses_mode) = A68_FALSE;
   A68 (top_soid_list) = NO_SOID;
   A68 (max_simplout_size) = 0;
@@ -444,10 +446,16 @@ void compiler_interpreter (void)
       bufcat (options, HAVE_PIC, BUFFER_SIZE);
 #endif
       ASSERT (snprintf (cmd, SNPRINTF_SIZE, "%s -I%s %s -c -o \"%s\" \"%s\"", C_COMPILER, INCLUDEDIR, options, FILE_BINARY_NAME (&A68_JOB), FILE_OBJECT_NAME (&A68_JOB)) >= 0);
-      ABEND (system (cmd) != 0, ERROR_ACTION, cmd);
-      ASSERT (snprintf (cmd, SNPRINTF_SIZE, "ld -export-dynamic -shared -o \"%s\" \"%s\"", FILE_PLUGIN_NAME (&A68_JOB), FILE_BINARY_NAME (&A68_JOB)) >= 0);
-      ABEND (system (cmd) != 0, ERROR_ACTION, cmd);
-      a68_rm (FILE_BINARY_NAME (&A68_JOB));
+// An unchanged program may have been compiled before.
+      if (!plugin_cache_fetch (cmd)) {
+        BUFFER link;
+        BUFCLR (link);
+        ABEND (system (cmd) != 0, ERROR_ACTION, cmd);
+        ASSERT (snprintf (link, SNPRINTF_SIZE, "ld -export-dynamic -shared -o \"%s\" \"%s\"", FILE_PLUGIN_NAME (&A68_JOB), FILE_BINARY_NAME (&A68_JOB)) >= 0);
+        ABEND (system (link) != 0, ERROR_ACTION, link);
+        a68_rm (FILE_BINARY_NAME (&A68_JOB));
+        plugin_cache_store (cmd);
+      }
     }
     verbosity ();
   }
@@ -574,7 +582,14 @@ void compiler_interpreter (void)
     a68_rm (FILE_SOURCE_NAME (&A68_JOB));
     a68_rm (FILE_PLUGIN_NAME (&A68_JOB));
   } else if (OPTION_COMPILE (&A68_JOB)) {
-    build_script ();
+// A program with errors has no plugin to pack.
+    if (ERROR_COUNT (&A68_JOB) > 0) {
+      ;
+    } else if (OPTION_EXECUTABLE (&A68_JOB)) {
+      build_executable ();
+    } else {
+      build_script ();
+    }
     if (!OPTION_KEEP (&A68_JOB)) {
       if (emitted) {
         a68_rm (FILE_OBJECT_NAME (&A68_JOB));
@@ -608,6 +623,10 @@ void a68_exit (int code)
 #endif
 // Close unclosed files, remove temp files.
   free_file_entries ();
+  free_regex_cache ();
+#if defined (BUILD_A68_COMPILER) && defined (BUILD_LINUX)
+  remove_executable_dir ();
+#endif
 // Close the terminal.
   if (A68 (close_tty_on_exit) || OPTION_REGRESSION_TEST (&A68_JOB)) {
     io_close_tty_line ();
@@ -624,6 +643,7 @@ void a68_exit (int code)
   free_syntax_tree (TOP_NODE (&A68_JOB));
   free_option_list (OPTION_LIST (&A68_JOB));
   a68_free (A68 (node_register));
+  a68_free (A68 (display));
   a68_free (A68 (options));
 //
   discard_heap ();
@@ -700,6 +720,7 @@ int main (int argc, char *argv[])
     SOURCE_SCAN (&A68_JOB) = 1;
     default_options (&A68_JOB);
     default_mem_sizes (1);
+    A68 (heap_limit_set) = A68_FALSE;
 // Initialise core.
     A68_STACK = NO_BYTE;
     A68_HEAP = NO_BYTE;
@@ -720,16 +741,23 @@ int main (int argc, char *argv[])
 // Options are processed here.
     read_rc_options ();
     read_env_options ();
+// A standalone executable brings its own program; arguments are for that program.
+    BOOL_T executable = A68_FALSE;
+#if defined (BUILD_A68_COMPILER) && defined (BUILD_LINUX)
+    executable = load_executable ();
+#endif
 // Posix copies arguments from the command line.
-    if (argc <= 1) {
-      online_help (STDOUT_FILENO);
-      a68_exit (EXIT_FAILURE);
-    }
-    for (int k = 1; k < argc; k++) {
-      add_option_list (&(OPTION_LIST (&A68_JOB)), argv[k], NO_LINE);
-    }
-    if (!set_options (OPTION_LIST (&A68_JOB), A68_TRUE)) {
-      a68_exit (EXIT_FAILURE);
+    if (!executable) {
+      if (argc <= 1) {
+        online_help (STDOUT_FILENO);
+        a68_exit (EXIT_FAILURE);
+      }
+      for (int k = 1; k < argc; k++) {
+        add_option_list (&(OPTION_LIST (&A68_JOB)), argv[k], NO_LINE);
+      }
+      if (!set_options (OPTION_LIST (&A68_JOB), A68_TRUE)) {
+        a68_exit (EXIT_FAILURE);
+      }
     }
 // State license.
     if (OPTION_LICENSE (&A68_JOB)) {
@@ -743,7 +771,7 @@ int main (int argc, char *argv[])
     init_before_tokeniser ();
 // Running a script.
 #if defined (BUILD_A68_COMPILER)
-    if (OPTION_RUN_SCRIPT (&A68_JOB)) {
+    if (OPTION_RUN_SCRIPT (&A68_JOB) && !executable) {
       load_script ();
     }
 #endif
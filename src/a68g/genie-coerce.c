@@ -354,7 +354,9 @@ PROP_T genie_dereference_slice_name_quick (NODE_T * p)
     A68_SP = pop_sp;
   }
 // Push element.
-  PUSH (p, &((ADDRESS (&(ARRAY (a))))[ROW_ELEMENT (a, row_index)]), size);
+  A68_REF elem = ARRAY (a);
+  OFFSET (&elem) += ROW_ELEMENT (a, row_index);
+  PUSH_ROW_ELEMENT (p, &elem, size);
   genie_check_initialisation (p, stack_top, deref_mode);
   return GPROP (p);
 }
@@ -66,7 +66,7 @@ void genie_f_and_becomes (NODE_T * p, MOID_T * ref, GPROC * f)
 
 void genie_system_heap_pointer (NODE_T * p)
 {
-  PUSH_VALUE (p, (int) (A68_HP), A68_INT);
+  PUSH_VALUE (p, (INT_T) (A68_HP), A68_INT);
 }
 
 //! @brief INT system stack pointer
@@ -30,52 +30,135 @@
 #include "a68g-double.h"
 #include "a68g-transput.h"
 
-//! @brief grep in string (STRING, STRING, REF INT, REF INT) INT.
+// Compiled patterns are kept in a small cache, keyed on pattern text and
+// compilation flags, so a loop applying one pattern to many strings compiles
+// it once. When the cache is full, the least recently used entry is evicted.
 
-int grep_in_string (char *pat, char *str, int *start, int *end)
+//! @brief Release a cache entry.
+
+static void free_regex_entry (REGEX_CACHE_T * e)
 {
-  int rc, nmatch, k, max_k, widest;
-  regex_t compiled;
-  regmatch_t *matches;
-  rc = regcomp (&compiled, pat, REG_NEWLINE | REG_EXTENDED);
-  if (rc != 0) {
-    regfree (&compiled);
-    return rc;
+  if (PATTERN (e) != NO_TEXT) {
+    regfree (&COMPILED (e));
+    a68_free (PATTERN (e));
+    a68_free (MATCHES (e));
+    PATTERN (e) = NO_TEXT;
+    MATCHES (e) = NO_REGMATCH;
+  }
+}
+
+//! @brief Release all compiled patterns.
+
+void free_regex_cache (void)
+{
+  for (int k = 0; k < REGEX_CACHE_SIZE; k++) {
+    free_regex_entry (&A68_REGEX (cache)[k]);
+  }
+}
+
+//! @brief Compiled pattern from the cache, compiling it when absent.
+
+static REGEX_CACHE_T *compile_regex (char *pat, int flags, int *rc)
+{
+  REGEX_CACHE_T *lru = &A68_REGEX (cache)[0];
+  for (int k = 0; k < REGEX_CACHE_SIZE; k++) {
+    REGEX_CACHE_T *e = &A68_REGEX (cache)[k];
+    if (PATTERN (e) != NO_TEXT && FLAGS (e) == flags && strcmp (PATTERN (e), pat) == 0) {
+      USED (e) = ++A68_REGEX (clock);
+      A68_REGEX (hits)++;
+      *rc = 0;
+      return e;
+    } else if (PATTERN (lru) != NO_TEXT && (PATTERN (e) == NO_TEXT || USED (e) < USED (lru))) {
+      lru = e;
+    }
+  }
+  A68_REGEX (misses)++;
+  free_regex_entry (lru);
+  *rc = regcomp (&COMPILED (lru), pat, flags);
+  if (*rc != 0) {
+    regfree (&COMPILED (lru));
+    return NO_REGEX_CACHE;
   }
-  nmatch = (int) (RE_NSUB (&compiled));
-  if (nmatch == 0) {
-    nmatch = 1;
+  NMATCH (lru) = (int) (RE_NSUB (&COMPILED (lru)));
+  if (NMATCH (lru) == 0) {
+    NMATCH (lru) = 1;
   }
-  matches = a68_alloc ((size_t) (nmatch * SIZE_ALIGNED (regmatch_t)), __func__, __LINE__);
-  if (nmatch > 0 && matches == NO_REGMATCH) {
-    regfree (&compiled);
-    return 2;
+  MATCHES (lru) = a68_alloc ((size_t) (NMATCH (lru) * SIZE_ALIGNED (regmatch_t)), __func__, __LINE__);
+  PATTERN (lru) = a68_alloc (strlen (pat) + 1, __func__, __LINE__);
+  if (MATCHES (lru) == NO_REGMATCH || PATTERN (lru) == NO_TEXT) {
+    regfree (&COMPILED (lru));
+    a68_free (MATCHES (lru));
+    a68_free (PATTERN (lru));
+    MATCHES (lru) = NO_REGMATCH;
+    PATTERN (lru) = NO_TEXT;
+    *rc = REG_ESPACE;
+    return NO_REGEX_CACHE;
+  }
+  bufcpy (PATTERN (lru), pat, strlen (pat) + 1);
+  FLAGS (lru) = flags;
+  USED (lru) = ++A68_REGEX (clock);
+  return lru;
+}
+
+//! @brief Match string against a pattern and return index of the widest match.
+
+static int match_regex (char *pat, char *str, int eflags, regmatch_t ** matches)
+{
+  int rc, k, max_k, widest;
+  REGEX_CACHE_T *e = compile_regex (pat, REG_NEWLINE | REG_EXTENDED, &rc);
+  if (e == NO_REGEX_CACHE) {
+    return -rc;
   }
-  rc = regexec (&compiled, str, (size_t) nmatch, matches, 0);
+  rc = regexec (&COMPILED (e), str, (size_t) NMATCH (e), MATCHES (e), eflags);
   if (rc != 0) {
-    regfree (&compiled);
-    return rc;
+    return -rc;
   }
 // Find widest match. Do not assume it is the first one.
   widest = 0;
   max_k = 0;
-  for (k = 0; k < nmatch; k++) {
-    int dif = (int) RM_EO (&matches[k]) - (int) RM_SO (&matches[k]);
+  for (k = 0; k < NMATCH (e); k++) {
+    int dif = (int) RM_EO (&(MATCHES (e)[k])) - (int) RM_SO (&(MATCHES (e)[k]));
     if (dif > widest) {
       widest = dif;
       max_k = k;
     }
   }
+  *matches = MATCHES (e);
+  return max_k;
+}
+
+//! @brief grep in string (STRING, STRING, REF INT, REF INT) INT.
+
+int grep_in_string (char *pat, char *str, int *start, int *end)
+{
+  regmatch_t *matches;
+  int k = match_regex (pat, str, 0, &matches);
+  if (k < 0) {
+    return -k;
+  }
   if (start != NO_INT) {
-    (*start) = (int) RM_SO (&matches[max_k]);
+    (*start) = (int) RM_SO (&matches[k]);
   }
   if (end != NO_INT) {
-    (*end) = (int) RM_EO (&matches[max_k]);
+    (*end) = (int) RM_EO (&matches[k]);
   }
-  a68_free (matches);
   return 0;
 }
 
+//! @brief INT regex cache hits
+
+void genie_regex_cache_hits (NODE_T * p)
+{
+  PUSH_VALUE (p, A68_REGEX (hits), A68_INT);
+}
+
+//! @brief INT regex cache misses
+
+void genie_regex_cache_misses (NODE_T * p)
+{
+  PUSH_VALUE (p, A68_REGEX (misses), A68_INT);
+}
+
 //! @brief Return code for regex interface.
 
 void push_grep_rc (NODE_T * p, int rc)
@@ -104,16 +187,15 @@ void push_grep_rc (NODE_T * p, int rc)
   }
 }
 
-//! @brief PROC grep in string = (STRING, STRING, REF INT, REF INT) INT
+//! @brief Common part of grep in string and grep in substring.
 
-void genie_grep_in_string (NODE_T * p)
+static void genie_grep (NODE_T * p, int eflags)
 {
   A68_REF ref_pat, ref_beg, ref_end, ref_str, row;
   A68_ARRAY *arr;
   A68_TUPLE *tup;
-  int rc, nmatch, k, max_k, widest;
-  regex_t compiled;
   regmatch_t *matches;
+  int k;
   POP_REF (p, &ref_end);
   POP_REF (p, &ref_beg);
   POP_REF (p, &ref_str);
@@ -125,119 +207,36 @@ void genie_grep_in_string (NODE_T * p)
   reset_transput_buffer (STRING_BUFFER);
   add_a_string_transput_buffer (p, PATTERN_BUFFER, (BYTE_T *) & ref_pat);
   add_a_string_transput_buffer (p, STRING_BUFFER, (BYTE_T *) & ref_str);
-  rc = regcomp (&compiled, get_transput_buffer (PATTERN_BUFFER), REG_NEWLINE | REG_EXTENDED);
-  if (rc != 0) {
-    push_grep_rc (p, rc);
-    regfree (&compiled);
+  k = match_regex (get_transput_buffer (PATTERN_BUFFER), get_transput_buffer (STRING_BUFFER), eflags, &matches);
+  if (k < 0) {
+    push_grep_rc (p, -k);
     return;
   }
-  nmatch = (int) (RE_NSUB (&compiled));
-  if (nmatch == 0) {
-    nmatch = 1;
-  }
-  matches = a68_alloc ((size_t) (nmatch * SIZE_ALIGNED (regmatch_t)), __func__, __LINE__);
-  if (nmatch > 0 && matches == NULL) {
-    rc = 2;
-    PUSH_VALUE (p, rc, A68_INT);
-    regfree (&compiled);
-    return;
-  }
-  rc = regexec (&compiled, get_transput_buffer (STRING_BUFFER), (size_t) nmatch, matches, 0);
-  if (rc != 0) {
-    push_grep_rc (p, rc);
-    regfree (&compiled);
-    return;
-  }
-// Find widest match. Do not assume it is the first one.
-  widest = 0;
-  max_k = 0;
-  for (k = 0; k < nmatch; k++) {
-    int dif = (int) (RM_EO (&(matches[k]))) - (int) (RM_SO (&(matches[k])));
-    if (dif > widest) {
-      widest = dif;
-      max_k = k;
-    }
-  }
   if (!IS_NIL (ref_beg)) {
     A68_INT *i = DEREF (A68_INT, &ref_beg);
     STATUS (i) = INIT_MASK;
-    VALUE (i) = (int) (RM_SO (&(matches[max_k]))) + (int) (LOWER_BOUND (tup));
+    VALUE (i) = (int) (RM_SO (&(matches[k]))) + (int) (LOWER_BOUND (tup));
   }
   if (!IS_NIL (ref_end)) {
     A68_INT *i = DEREF (A68_INT, &ref_end);
     STATUS (i) = INIT_MASK;
-    VALUE (i) = (int) (RM_EO (&(matches[max_k]))) + (int) (LOWER_BOUND (tup)) - 1;
+    VALUE (i) = (int) (RM_EO (&(matches[k]))) + (int) (LOWER_BOUND (tup)) - 1;
   }
-  a68_free (matches);
   push_grep_rc (p, 0);
 }
 
+//! @brief PROC grep in string = (STRING, STRING, REF INT, REF INT) INT
+
+void genie_grep_in_string (NODE_T * p)
+{
+  genie_grep (p, 0);
+}
+
 //! @brief PROC grep in substring = (STRING, STRING, REF INT, REF INT) INT
 
 void genie_grep_in_substring (NODE_T * p)
 {
-  A68_REF ref_pat, ref_beg, ref_end, ref_str, row;
-  A68_ARRAY *arr;
-  A68_TUPLE *tup;
-  int rc, nmatch, k, max_k, widest;
-  regex_t compiled;
-  regmatch_t *matches;
-  POP_REF (p, &ref_end);
-  POP_REF (p, &ref_beg);
-  POP_REF (p, &ref_str);
-  POP_REF (p, &ref_pat);
-  row = *(A68_REF *) & ref_str;
-  CHECK_INIT (p, INITIALISED (&row), M_ROWS);
-  GET_DESCRIPTOR (arr, tup, &row);
-  reset_transput_buffer (PATTERN_BUFFER);
-  reset_transput_buffer (STRING_BUFFER);
-  add_a_string_transput_buffer (p, PATTERN_BUFFER, (BYTE_T *) & ref_pat);
-  add_a_string_transput_buffer (p, STRING_BUFFER, (BYTE_T *) & ref_str);
-  rc = regcomp (&compiled, get_transput_buffer (PATTERN_BUFFER), REG_NEWLINE | REG_EXTENDED);
-  if (rc != 0) {
-    push_grep_rc (p, rc);
-    regfree (&compiled);
-    return;
-  }
-  nmatch = (int) (RE_NSUB (&compiled));
-  if (nmatch == 0) {
-    nmatch = 1;
-  }
-  matches = a68_alloc ((size_t) (nmatch * SIZE_ALIGNED (regmatch_t)), __func__, __LINE__);
-  if (nmatch > 0 && matches == NULL) {
-    rc = 2;
-    PUSH_VALUE (p, rc, A68_INT);
-    regfree (&compiled);
-    return;
-  }
-  rc = regexec (&compiled, get_transput_buffer (STRING_BUFFER), (size_t) nmatch, matches, REG_NOTBOL);
-  if (rc != 0) {
-    push_grep_rc (p, rc);
-    regfree (&compiled);
-    return;
-  }
-// Find widest match. Do not assume it is the first one.
-  widest = 0;
-  max_k = 0;
-  for (k = 0; k < nmatch; k++) {
-    int dif = (int) (RM_EO (&(matches[k]))) - (int) (RM_SO (&(matches[k])));
-    if (dif > widest) {
-      widest = dif;
-      max_k = k;
-    }
-  }
-  if (!IS_NIL (ref_beg)) {
-    A68_INT *i = DEREF (A68_INT, &ref_beg);
-    STATUS (i) = INIT_MASK;
-    VALUE (i) = (int) (RM_SO (&(matches[max_k]))) + (int) (LOWER_BOUND (tup));
-  }
-  if (!IS_NIL (ref_end)) {
-    A68_INT *i = DEREF (A68_INT, &ref_end);
-    STATUS (i) = INIT_MASK;
-    VALUE (i) = (int) (RM_EO (&(matches[max_k]))) + (int) (LOWER_BOUND (tup)) - 1;
-  }
-  a68_free (matches);
-  push_grep_rc (p, 0);
+  genie_grep (p, REG_NOTBOL);
 }
 
 //! @brief PROC sub in string = (STRING, STRING, REF STRING) INT
@@ -245,9 +244,8 @@ void genie_grep_in_substring (NODE_T * p)
 void genie_sub_in_string (NODE_T * p)
 {
   A68_REF ref_pat, ref_rep, ref_str;
-  int rc, nmatch, k, max_k, widest, begin, end;
+  int k, begin, end;
   char *txt;
-  regex_t compiled;
   regmatch_t *matches;
   POP_REF (p, &ref_str);
   POP_REF (p, &ref_rep);
@@ -261,40 +259,13 @@ void genie_sub_in_string (NODE_T * p)
   reset_transput_buffer (PATTERN_BUFFER);
   add_a_string_transput_buffer (p, PATTERN_BUFFER, (BYTE_T *) & ref_pat);
   add_a_string_transput_buffer (p, STRING_BUFFER, (BYTE_T *) DEREF (A68_REF, &ref_str));
-  rc = regcomp (&compiled, get_transput_buffer (PATTERN_BUFFER), REG_NEWLINE | REG_EXTENDED);
-  if (rc != 0) {
-    push_grep_rc (p, rc);
-    regfree (&compiled);
+  k = match_regex (get_transput_buffer (PATTERN_BUFFER), get_transput_buffer (STRING_BUFFER), 0, &matches);
+  if (k < 0) {
+    push_grep_rc (p, -k);
     return;
   }
-  nmatch = (int) (RE_NSUB (&compiled));
-  if (nmatch == 0) {
-    nmatch = 1;
-  }
-  matches = a68_alloc ((size_t) (nmatch * SIZE_ALIGNED (regmatch_t)), __func__, __LINE__);
-  if (nmatch > 0 && matches == NULL) {
-    PUSH_VALUE (p, rc, A68_INT);
-    regfree (&compiled);
-    return;
-  }
-  rc = regexec (&compiled, get_transput_buffer (STRING_BUFFER), (size_t) nmatch, matches, 0);
-  if (rc != 0) {
-    push_grep_rc (p, rc);
-    regfree (&compiled);
-    return;
-  }
-// Find widest match. Do not assume it is the first one.
-  widest = 0;
-  max_k = 0;
-  for (k = 0; k < nmatch; k++) {
-    int dif = (int) RM_EO (&(matches[k])) - (int) RM_SO (&(matches[k]));
-    if (dif > widest) {
-      widest = dif;
-      max_k = k;
-    }
-  }
-  begin = (int) RM_SO (&(matches[max_k])) + 1;
-  end = (int) RM_EO (&(matches[max_k]));
+  begin = (int) RM_SO (&(matches[k])) + 1;
+  end = (int) RM_EO (&(matches[k]));
 // Substitute text.
   txt = get_transput_buffer (STRING_BUFFER);
   for (k = 0; k < begin - 1; k++) {
@@ -305,6 +276,5 @@ void genie_sub_in_string (NODE_T * p)
     plusab_transput_buffer (p, REPLACE_BUFFER, txt[k]);
   }
   *DEREF (A68_REF, &ref_str) = c_to_a_string (p, get_transput_buffer (REPLACE_BUFFER), DEFAULT_WIDTH);
-  a68_free (matches);
   push_grep_rc (p, 0);
 }
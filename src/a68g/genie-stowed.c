@@ -122,14 +122,14 @@ void print_internal_index (FILE_T f, A68_TUPLE * tup, int dim)
 
 A68_REF c_string_to_row_char (NODE_T * p, char *str, int width)
 {
-  A68_REF z, row; A68_ARRAY arr; A68_TUPLE tup;
-  NEW_ROW_1D (z, row, arr, tup, M_ROW_CHAR, M_CHAR, width);
-  BYTE_T *base = ADDRESS (&row);
-  int len = strlen (str);
-  for (int k = 0; k < width; k++) {
-    A68_CHAR *ch = (A68_CHAR *) & (base[k * SIZE_ALIGNED (A68_CHAR)]);
-    STATUS (ch) = INIT_MASK;
-    VALUE (ch) = (k < len ? TO_UCHAR (str[k]) : NULL_CHAR);
+  BYTE_T *q;
+  A68_REF z = packed_string (p, width, &q);
+  int k = 0;
+  for (; k < width && str[k] != NULL_CHAR; k++) {
+    q[k] = (BYTE_T) TO_UCHAR (str[k]);
+  }
+  for (; k < width; k++) {
+    q[k] = NULL_CHAR;
   }
   return z;
 }
@@ -174,12 +174,14 @@ char *a_to_c_string (NODE_T * p, char *str, A68_REF row)
     GET_DESCRIPTOR (arr, tup, &row);
     int size = ROW_SIZE (tup), n = 0;
     if (size > 0) {
-      BYTE_T *base_address = ADDRESS (&ARRAY (arr));
-      for (int k = LWB (tup); k <= UPB (tup); k++) {
-        int addr = INDEX_1_DIM (arr, tup, k);
-        A68_CHAR *ch = (A68_CHAR *) & (base_address[addr]);
-        CHECK_INIT (p, INITIALISED (ch), M_CHAR);
-        str[n++] = (char) VALUE (ch);
+      BYTE_T *q;
+      int inc;
+      BOOL_T packed = char_sweep (arr, tup, &q, &inc);
+      for (int k = 0; k < size; k++, q += inc) {
+        if (!packed) {
+          CHECK_INIT (p, INITIALISED ((A68_CHAR *) q), M_CHAR);
+        }
+        str[n++] = (char) CHAR_AT (packed, q);
       }
     }
     str[n] = NULL_CHAR;
@@ -317,7 +319,7 @@ A68_REF genie_make_rowrow (NODE_T * p, MOID_T * rmod, int len, ADDR_T sp)
             A68_REF none = genie_clone (p, emod, (A68_REF *) & nil_ref, &src);
             MOVE (ADDRESS (&dst), ADDRESS (&none), SIZE (emod));
           } else {
-            MOVE (ADDRESS (&dst), ADDRESS (&src), SIZE (emod));
+            GET_ROW_ELEMENT (ADDRESS (&dst), &src, SIZE (emod));
           }
           done = increment_internal_index (old_tup, odim) | increment_internal_index (&new_tup[1], odim);
         }
@@ -604,8 +606,13 @@ A68_REF genie_clone (NODE_T * p, MOID_T * m, A68_REF * tmp, A68_REF * old)
       span *= ROW_SIZE (np);
     }
 // Make a new array with at least a ghost element.
+    BOOL_T packed = (em == M_CHAR && DIM (old_arr) == 1 && span > 0 && packable_chars (old_arr, old_tup));
     if (span == 0) {
       ARRAY (new_arr) = heap_generator (p, em, ELEM_SIZE (new_arr));
+    } else if (packed) {
+      ELEM_SIZE (new_arr) = SIZE (M_CHAR);
+      ARRAY (new_arr) = heap_generator (p, em, span);
+      STATUS_SET (REF_HANDLE (&ARRAY (new_arr)), PACKED_MASK);
     } else {
       ARRAY (new_arr) = heap_generator (p, em, span * ELEM_SIZE (new_arr));
     }
@@ -622,6 +629,21 @@ A68_REF genie_clone (NODE_T * p, MOID_T * m, A68_REF * tmp, A68_REF * old)
         a68_clone = genie_clone (p, em, &ntmp, &old_ref);
         MOVE (ADDRESS (&dst_ref), ADDRESS (&a68_clone), SIZE (em));
       }
+    } else if (packed) {
+// Characters that fit in a byte go into a packed block.
+      copy_chars (ADDRESS (&ARRAY (new_arr)), A68_TRUE, 1, old_arr, old_tup);
+    } else if (DIM (old_arr) == 1 && !HAS_ROWS (em)) {
+// A one-dimensional row, like a STRING, is copied without the index machinery.
+      BYTE_T *src = &(ADDRESS (&ARRAY (old_arr))[VECTOR_OFFSET (old_arr, old_tup)]);
+      BYTE_T *dst = &(ADDRESS (&ARRAY (new_arr))[VECTOR_OFFSET (new_arr, new_tup)]);
+      int old_inc = SPAN (old_tup) * ELEM_SIZE (old_arr), new_inc = SPAN (new_tup) * ELEM_SIZE (new_arr);
+      if (old_inc == SIZE (em) && new_inc == SIZE (em)) {
+        COPY_ALIGNED (dst, src, span * SIZE (em));
+      } else {
+        for (int k = 0; k < span; k++, src += old_inc, dst += new_inc) {
+          MOVE (dst, src, SIZE (em));
+        }
+      }
     } else if (span > 0) {
 // The n-dimensional copier.
       initialise_internal_index (old_tup, DIM (old_arr));
@@ -638,7 +660,7 @@ A68_REF genie_clone (NODE_T * p, MOID_T * m, A68_REF * tmp, A68_REF * old)
           a68_clone = genie_clone (p, em, &ntmp, &old_ref);
           MOVE (ADDRESS (&dst_ref), ADDRESS (&a68_clone), SIZE (em));
         } else {
-          MOVE (ADDRESS (&dst_ref), ADDRESS (&old_ref), SIZE (em));
+          GET_ROW_ELEMENT (ADDRESS (&dst_ref), &old_ref, SIZE (em));
         }
 // Increase pointers.
         done = increment_internal_index (old_tup, DIM (old_arr)) | increment_internal_index (new_tup, DIM (new_arr));
@@ -693,6 +715,19 @@ A68_REF genie_store (NODE_T * p, MOID_T * m, A68_REF * dst, A68_REF * old)
         ARRAY (new_arr) = heap_generator (p, em, span * ELEM_SIZE (new_arr));
       }
     } 
+    if (span > 0 && em == M_CHAR && PACKED_ROW (&ARRAY (new_arr))) {
+// A packed destination takes characters that fit in a byte, else it is unpacked first.
+      if (DIM (new_arr) == 1 && packable_chars (old_arr, old_tup)) {
+        BYTE_T *q;
+        int inc;
+        (void) char_sweep (new_arr, new_tup, &q, &inc);
+        copy_chars (q, A68_TRUE, inc, old_arr, old_tup);
+        return *dst;
+      }
+      unpack_row (p, &ARRAY (new_arr));
+      GET_DESCRIPTOR (old_arr, old_tup, DEREF (A68_REF, old));
+      GET_DESCRIPTOR (new_arr, new_tup, DEREF (A68_REF, dst));
+    }
     if (span > 0) {
       initialise_internal_index (old_tup, DIM (old_arr));
       initialise_internal_index (new_tup, DIM (new_arr));
@@ -702,7 +737,7 @@ A68_REF genie_store (NODE_T * p, MOID_T * m, A68_REF * dst, A68_REF * old)
         ADDR_T new_index = calculate_internal_index (new_tup, DIM (new_arr));
         OFFSET (&new_old) += ROW_ELEMENT (old_arr, old_index);
         OFFSET (&new_dst) += ROW_ELEMENT (new_arr, new_index);
-        MOVE (ADDRESS (&new_dst), ADDRESS (&new_old), SIZE (em));
+        GET_ROW_ELEMENT (ADDRESS (&new_dst), &new_old, SIZE (em));
         done = increment_internal_index (old_tup, DIM (old_arr)) | increment_internal_index (new_tup, DIM (new_arr));
       }
     }
@@ -929,6 +964,11 @@ PROP_T genie_slice_name_quick (NODE_T * p)
     sindex += (SPAN (t) * k - SHIFT (t));
     A68_SP = pop_sp;
   }
+// Elements of a name are addressed as A68_CHARs, so unpack the block.
+  if (PACKED_ROW (&ARRAY (a))) {
+    unpack_row (p, &ARRAY (a));
+    GET_DESCRIPTOR (a, t, DEREF (A68_ROW, z));
+  }
 // Leave reference to element on the stack, preserving scope.
   ADDR_T scope = REF_SCOPE (z);
   *z = ARRAY (a);
@@ -993,6 +1033,13 @@ PROP_T genie_slice (NODE_T * p)
 // Slice of a name yields a name.
     A68_SP = pop_sp;
     if (slice_of_name) {
+// Elements of a name are addressed as A68_CHARs, so unpack the block.
+      if (PACKED_ROW (&ARRAY (a))) {
+        PUSH_REF (p, z);
+        unpack_row (p, &ARRAY (a));
+        A68_SP = pop_sp;
+        GET_DESCRIPTOR (a, t, &z);
+      }
       A68_REF name = ARRAY (a);
       OFFSET (&name) += ROW_ELEMENT (a, sindex);
       REF_SCOPE (&name) = scope;
@@ -1003,7 +1050,9 @@ PROP_T genie_slice (NODE_T * p)
       }
     } else {
       BYTE_T *stack_top = STACK_TOP;
-      PUSH (p, &((ADDRESS (&(ARRAY (a))))[ROW_ELEMENT (a, sindex)]), SIZE (result_mode));
+      A68_REF elem = ARRAY (a);
+      OFFSET (&elem) += ROW_ELEMENT (a, sindex);
+      PUSH_ROW_ELEMENT (p, &elem, SIZE (result_mode));
       genie_check_initialisation (p, stack_top, result_mode);
     }
     return self;
@@ -622,6 +622,7 @@ void genie_fork (NODE_T * p)
 #else
   int pid;
   errno = 0;
+  flush_write_buffers ();
   pid = (int) fork ();
   PUSH_VALUE (p, pid, A68_INT);
 #endif
@@ -648,6 +649,7 @@ void genie_exec (NODE_T * p)
     diagnostic (A68_RUNTIME_ERROR, p, ERROR_EMPTY_ARGUMENT);
     exit_genie (p, A68_RUNTIME_ERROR);
   }
+  flush_write_buffers ();
   ret = execve (prog, argv, envp);
 // execve only returns if it fails.
   free_vector (argv);
@@ -674,6 +676,7 @@ void genie_exec_sub (NODE_T * p)
   PUSH_VALUE (p, -1, A68_INT);
   return;
 #else
+  flush_write_buffers ();
   pid = (int) fork ();
   if (pid == -1) {
     PUSH_VALUE (p, -1, A68_INT);
@@ -732,6 +735,7 @@ void genie_exec_sub_pipeline (NODE_T * p)
     genie_mkpipe (p, -1, -1, -1);
     return;
   }
+  flush_write_buffers ();
   pid = (int) fork ();
   if (pid == -1) {
 // Fork failure.
@@ -802,6 +806,7 @@ void genie_exec_sub_output (NODE_T * p)
     PUSH_VALUE (p, -1, A68_INT);
     return;
   }
+  flush_write_buffers ();
   pid = (int) fork ();
   if (pid == -1) {
 // Fork failure.
@@ -31,6 +31,7 @@
 #include "a68g-double.h"
 #include "a68g-parser.h"
 #include "a68g-transput.h"
+#include "a68g-torrix.h"
 
 //! @brief Nop for the genie, for instance '+' for INT or REAL.
 
@@ -73,6 +74,7 @@ void genie_system (NODE_T * p)
   CHECK_INIT (p, INITIALISED (&cmd), M_STRING);
   size = 1 + a68_string_size (p, cmd);
   ref_z = heap_generator (p, M_C_STRING, 1 + size);
+  flush_write_buffers ();
   sys_ret_code = system (a_to_c_string (p, DEREF (char, &ref_z), cmd));
   PUSH_VALUE (p, sys_ret_code, A68_INT);
 }
@@ -104,6 +106,7 @@ void exit_genie (NODE_T * p, int ret)
   if (!A68 (in_execution)) {
     return;
   }
+  flush_write_buffers ();
   if (ret == A68_RUNTIME_ERROR && A68 (in_monitor)) {
     return;
   } else if (ret == A68_RUNTIME_ERROR && OPTION_DEBUG (&A68_JOB)) {
@@ -252,6 +255,65 @@ int mode_attribute (MOID_T * p)
   }
 }
 
+//! @brief Thread the units of a serial clause without labels.
+
+static void genie_link_units (NODE_T * p, NODE_T ** seq)
+{
+  for (; p != NO_NODE; FORWARD (p)) {
+    switch (ATTRIBUTE (p)) {
+    case DECLARATION_LIST:
+    case UNIT:
+      {
+        SEQUENCE (*seq) = p;
+        (*seq) = p;
+        return;
+      }
+    case SEMI_SYMBOL:
+      {
+        SEQUENCE (*seq) = p;
+        (*seq) = p;
+        break;
+      }
+    default:
+      {
+        genie_link_units (SUB (p), seq);
+        break;
+      }
+    }
+  }
+}
+
+//! @brief Thread a serial or enquiry clause without labels.
+
+static void genie_link_clause (NODE_T * p)
+{
+// This is the list genie_serial_clause and genie_enquiry_clause would build
+// on first execution; having it up front, every execution takes the fast path.
+  if (LABELS (TABLE (p)) == NO_TAG && SEQUENCE (p) == NO_NODE && !STATUS_TEST (p, SEQUENCE_MASK)) {
+    NODE_T top_seq;
+    NODE_T *seq = &top_seq;
+    SEQUENCE (&top_seq) = NO_NODE;
+    genie_link_units (SUB (p), &seq);
+    SEQUENCE (p) = SEQUENCE (&top_seq);
+    STATUS_SET (p, SEQUENCE_MASK);
+    STATUS_SET (p, SERIAL_MASK);
+    if (SEQUENCE (p) != NO_NODE && SEQUENCE (SEQUENCE (p)) == NO_NODE) {
+      STATUS_SET (p, OPTIMAL_MASK);
+    }
+  }
+}
+
+//! @brief Nesting depth of a symbol table, which indexes the display.
+
+static int table_depth (TABLE_T * t)
+{
+  int depth = 0;
+  for (; PREVIOUS (t) != NO_TABLE; t = PREVIOUS (t)) {
+    depth++;
+  }
+  return depth;
+}
+
 //! @brief Perform tasks before interpretation.
 
 void genie_preprocess (NODE_T * p, int *max_lev, void *compile_plugin)
@@ -307,6 +369,13 @@ void genie_preprocess (NODE_T * p, int *max_lev, void *compile_plugin)
       if (LEX_LEVEL (p) > *max_lev) {
         *max_lev = LEX_LEVEL (p);
       }
+      DEPTH (TABLE (p)) = table_depth (TABLE (p));
+    }
+// Serial clauses nest to the left; only the outermost one is executed.
+    for (NODE_T *q = SUB (p); q != NO_NODE; FORWARD (q)) {
+      if ((IS (q, SERIAL_CLAUSE) || IS (q, ENQUIRY_CLAUSE)) && !IS (p, ATTRIBUTE (q))) {
+        genie_link_clause (q);
+      }
     }
     if (IS (p, FORMAT_TEXT)) {
       TAG_T *q = TAX (p);
@@ -317,17 +386,20 @@ void genie_preprocess (NODE_T * p, int *max_lev, void *compile_plugin)
       TAG_T *q = TAX (p);
       if (q != NO_TAG && NODE (q) != NO_NODE && TABLE (NODE (q)) != NO_TABLE) {
         LEVEL (GINFO (p)) = LEX_LEVEL (NODE (q));
+        DEPTH (GINFO (p)) = table_depth (TABLE (NODE (q)));
       }
     } else if (IS (p, IDENTIFIER)) {
       TAG_T *q = TAX (p);
       if (q != NO_TAG && NODE (q) != NO_NODE && TABLE (NODE (q)) != NO_TABLE) {
         LEVEL (GINFO (p)) = LEX_LEVEL (NODE (q));
+        DEPTH (GINFO (p)) = table_depth (TABLE (NODE (q)));
         OFFSET (GINFO (p)) = &(A68_STACK[FRAME_INFO_SIZE + OFFSET (q)]);
       }
     } else if (IS (p, OPERATOR)) {
       TAG_T *q = TAX (p);
       if (q != NO_TAG && NODE (q) != NO_NODE && TABLE (NODE (q)) != NO_TABLE) {
         LEVEL (GINFO (p)) = LEX_LEVEL (NODE (q));
+        DEPTH (GINFO (p)) = table_depth (TABLE (NODE (q)));
         OFFSET (GINFO (p)) = &(A68_STACK[FRAME_INFO_SIZE + OFFSET (q)]);
       }
     }
@@ -354,6 +426,21 @@ void get_global_level (NODE_T * p)
   }
 }
 
+//! @brief Mark ranges that need no frame of their own.
+
+static void genie_frameless (NODE_T * p)
+{
+  for (; p != NO_NODE; FORWARD (p)) {
+    TABLE_T *t = TABLE (p);
+    if (t != NO_TABLE) {
+// Ranges that declare nothing run in the frame of their environ.
+// The global range keeps its frame since A68_GLOBALS points to it.
+      FRAMELESS (t) = (BOOL_T) (LEVEL (t) > A68 (global_level) && AP_INCREMENT (t) == 0 && IDENTIFIERS (t) == NO_TAG && OPERATORS (t) == NO_TAG && PRIO (t) == NO_TAG && INDICANTS (t) == NO_TAG && LABELS (t) == NO_TAG && ANONYMOUS (t) == NO_TAG);
+    }
+    genie_frameless (SUB (p));
+  }
+}
+
 //! @brief Driver for the interpreter.
 
 void genie (void *compile_plugin)
@@ -369,6 +456,8 @@ void genie (void *compile_plugin)
   A68 (max_lex_lvl) = 0;
 //  genie_lex_levels (TOP_NODE (&A68_JOB), 1);.
   genie_preprocess (TOP_NODE (&A68_JOB), &A68 (max_lex_lvl), compile_plugin);
+  a68_free (A68 (display));
+  A68 (display) = (ADDR_T *) get_heap_space ((size_t) (A68 (max_lex_lvl) + 1) * sizeof (ADDR_T));
   change_masks (TOP_NODE (&A68_JOB), BREAKPOINT_INTERRUPT_MASK, A68_FALSE);
   A68_MON (watchpoint_expression) = NO_TEXT;
   A68 (frame_stack_limit) = A68 (frame_end) - A68 (storage_overhead);
@@ -388,6 +477,9 @@ void genie (void *compile_plugin)
   A68 (do_confirm_exit) = A68_TRUE;
 #if defined (BUILD_PARALLEL_CLAUSE)
   ASSERT (pthread_mutex_init (&A68_PAR (unit_sema), NULL) == 0);
+  ASSERT (pthread_mutex_init (&A68_PAR (pool_sema), NULL) == 0);
+  ASSERT (pthread_cond_init (&A68_PAR (unit_cond), NULL) == 0);
+  ASSERT (pthread_cond_init (&A68_PAR (pool_cond), NULL) == 0);
 #endif
 // Dive into the program.
   if (setjmp (A68 (genie_exit_label)) == 0) {
@@ -402,6 +494,7 @@ void genie (void *compile_plugin)
     A68 (global_level) = INT_MAX;
     A68_GLOBALS = 0;
     get_global_level (p);
+    genie_frameless (TOP_NODE (&A68_JOB));
     A68_FP = A68 (frame_start);
     A68_SP = A68 (stack_start);
     FRAME_DYNAMIC_LINK (A68_FP) = 0;
@@ -410,8 +503,10 @@ void genie (void *compile_plugin)
     FRAME_NUMBER (A68_FP) = 0;
     FRAME_TREE (A68_FP) = (NODE_T *) p;
     FRAME_LEXICAL_LEVEL (A68_FP) = LEX_LEVEL (p);
+    FRAME_LEXICAL_DEPTH (A68_FP) = LEX_DEPTH (p);
     FRAME_PARAMETER_LEVEL (A68_FP) = LEX_LEVEL (p);
     FRAME_PARAMETERS (A68_FP) = A68_FP;
+    SET_DISPLAY (-1);
     initialise_frame (p);
     genie_init_heap (p);
     genie_init_transput (TOP_NODE (&A68_JOB));
@@ -450,6 +545,7 @@ void genie (void *compile_plugin)
       }
     }
   }
+  flush_write_buffers ();
   A68 (in_execution) = A68_FALSE;
 }
 
@@ -467,8 +563,8 @@ void where_in_source (FILE_T f, NODE_T * p)
   write_source_line (f, LINE (INFO (p)), p, A68_NO_DIAGNOSTICS);
 }
 
-// Since Algol 68 can pass procedures as parameters, we use static links rather
-// than a display.
+// Since Algol 68 can pass procedures as parameters, frames keep static links;
+// a display derived from them gives direct access to each lexical level.
 
 //! @brief Initialise PROC and OP identities.
 
@@ -1388,6 +1484,11 @@ PROP_T genie_formula (NODE_T * p)
     if (proc != NO_GPROC) {
       (void) ((*(proc)) (op));
       UNIT (&self) = genie_dyadic_quick;
+#if defined (HAVE_GSL)
+      if (is_torrix_fusable (p)) {
+        UNIT (&self) = genie_formula_torrix;
+      }
+#endif
     } else {
       genie_call_operator (op, pop_sp);
     }
@@ -1825,7 +1926,7 @@ PROP_T genie_unit (NODE_T * p)
 // Ex primary.
     case ENCLOSED_CLAUSE:
       {
-        GLOBAL_PROP (&A68_JOB) = genie_enclosed ((volatile NODE_T *) p);
+        GLOBAL_PROP (&A68_JOB) = genie_enclosed (p);
         break;
       }
     case IDENTIFIER:
@@ -1990,9 +2091,9 @@ void genie_serial_units_no_label (NODE_T * p, ADDR_T pop_sp, NODE_T ** seq)
   }
 }
 
-//! @brief Execution of serial clause with labels.
+//! @brief Execution of serial clause with labels; returns whether EXIT was taken.
 
-void genie_serial_units (NODE_T * p, NODE_T ** jump_to, jmp_buf * exit_buf, ADDR_T pop_sp)
+BOOL_T genie_serial_units (NODE_T * p, NODE_T ** jump_to, ADDR_T pop_sp)
 {
   LOW_STACK_ALERT (p);
   for (; p != NO_NODE; FORWARD (p)) {
@@ -2007,12 +2108,12 @@ void genie_serial_units (NODE_T * p, NODE_T ** jump_to, jmp_buf * exit_buf, ADDR
           *jump_to = NO_NODE;
           EXECUTE_UNIT_TRACE (p);
         }
-        return;
+        return A68_FALSE;
       }
     case EXIT_SYMBOL:
       {
         if (*jump_to == NO_NODE) {
-          longjmp (*exit_buf, 1);
+          return A68_TRUE;
         }
         break;
       }
@@ -2026,16 +2127,19 @@ void genie_serial_units (NODE_T * p, NODE_T ** jump_to, jmp_buf * exit_buf, ADDR
       }
     default:
       {
-        genie_serial_units (SUB (p), jump_to, exit_buf, pop_sp);
+        if (genie_serial_units (SUB (p), jump_to, pop_sp)) {
+          return A68_TRUE;
+        }
         break;
       }
     }
   }
+  return A68_FALSE;
 }
 
 //! @brief Execute serial clause.
 
-void genie_serial_clause (NODE_T * p, jmp_buf * exit_buf)
+void genie_serial_clause (NODE_T * p)
 {
   if (LABELS (TABLE (p)) == NO_TAG) {
 // No labels in this clause.
@@ -2080,14 +2184,15 @@ void genie_serial_clause (NODE_T * p, jmp_buf * exit_buf)
     FRAME_JUMP_STAT (A68_FP) = &jump_stat;
     if (!setjmp (jump_stat)) {
       NODE_T *jump_to = NO_NODE;
-      genie_serial_units (SUB (p), &jump_to, exit_buf, A68_SP);
+      (void) genie_serial_units (SUB (p), &jump_to, A68_SP);
     } else {
 // HIjol! Restore state and look for indicated unit.
       NODE_T *jump_to = JUMP_TO (TABLE (p));
       A68_SP = pop_sp;
       A68_FP = pop_fp;
+      SET_DISPLAY (-1);
       FRAME_DNS (A68_FP) = pop_dns;
-      genie_serial_units (SUB (p), &jump_to, exit_buf, A68_SP);
+      (void) genie_serial_units (SUB (p), &jump_to, A68_SP);
     }
   }
 }
@@ -2232,8 +2337,7 @@ BOOL_T genie_united_case_unit (NODE_T * p, MOID_T * m)
       }
       if (equal_modes) {
         NODE_T *q = NEXT_NEXT (SUB (p));
-        OPEN_STATIC_FRAME (p);
-        INIT_STATIC_FRAME (p);
+        OPEN_RANGE (p);
         if (IS (q, IDENTIFIER)) {
           if (IS_UNION (spec_moid)) {
             COPY ((FRAME_OBJECT (OFFSET (TAX (q)))), STACK_TOP, SIZE (spec_moid));
@@ -2242,7 +2346,7 @@ BOOL_T genie_united_case_unit (NODE_T * p, MOID_T * m)
           }
         }
         EXECUTE_UNIT_TRACE (NEXT_NEXT (p));
-        CLOSE_FRAME;
+        CLOSE_RANGE (p);
         return A68_TRUE;
       } else {
         return A68_FALSE;
@@ -2472,9 +2576,8 @@ void genie_declaration (NODE_T * p)
   } else if (STATUS_TEST ((_p_), SERIAL_MASK)) {\
     LABEL_FREE (_p_);\
   } else {\
-    if (!setjmp (exit_buf)) {\
-      genie_serial_clause ((NODE_T *) (_p_), (jmp_buf *) exit_buf);\
-  }}
+    genie_serial_clause ((NODE_T *) (_p_));\
+  }
 
 #define ENQUIRY_CLAUSE(_p_)\
   genie_preemptive_gc_heap ((NODE_T *) (_p_));\
@@ -2488,27 +2591,24 @@ void genie_declaration (NODE_T * p)
 
 //! @brief Execute integral-case-clause.
 
-PROP_T genie_int_case (volatile NODE_T * p)
+PROP_T genie_int_case (NODE_T * p)
 {
-  volatile int unit_count;
-  volatile BOOL_T found_unit;
-  jmp_buf exit_buf;
+  int unit_count;
+  BOOL_T found_unit;
   A68_INT k;
-  volatile NODE_T *q = SUB (p);
-  volatile MOID_T *yield = MOID (q);
+  NODE_T *q = SUB (p);
+  MOID_T *yield = MOID (q);
 // CASE or OUSE.
-  OPEN_STATIC_FRAME ((NODE_T *) SUB (q));
-  INIT_GLOBAL_POINTER ((NODE_T *) SUB (q));
-  INIT_STATIC_FRAME ((NODE_T *) SUB (q));
+  OPEN_RANGE (SUB (q));
+  INIT_GLOBAL_POINTER (SUB (q));
   ENQUIRY_CLAUSE (NEXT_SUB (q));
   POP_OBJECT (q, &k, A68_INT);
 // IN.
   FORWARD (q);
-  OPEN_STATIC_FRAME ((NODE_T *) SUB (q));
-  INIT_STATIC_FRAME ((NODE_T *) SUB (q));
+  OPEN_RANGE (SUB (q));
   unit_count = 1;
-  found_unit = genie_int_case_unit (NEXT_SUB ((NODE_T *) q), (int) VALUE (&k), (int *) &unit_count);
-  CLOSE_FRAME;
+  found_unit = genie_int_case_unit (NEXT_SUB (q), (int) VALUE (&k), &unit_count);
+  CLOSE_RANGE (SUB (q));
 // OUT.
   if (!found_unit) {
     FORWARD (q);
@@ -2516,58 +2616,54 @@ PROP_T genie_int_case (volatile NODE_T * p)
     case CHOICE:
     case OUT_PART:
       {
-        OPEN_STATIC_FRAME ((NODE_T *) SUB (q));
-        INIT_STATIC_FRAME ((NODE_T *) SUB (q));
+        OPEN_RANGE (SUB (q));
         SERIAL_CLAUSE (NEXT_SUB (q));
-        CLOSE_FRAME;
+        CLOSE_RANGE (SUB (q));
         break;
       }
     case CLOSE_SYMBOL:
     case ESAC_SYMBOL:
       {
         if (yield != M_VOID) {
-          genie_push_undefined ((NODE_T *) q, (MOID_T *) yield);
+          genie_push_undefined (q, yield);
         }
         break;
       }
     default:
       {
-        MOID (SUB ((NODE_T *) q)) = (MOID_T *) yield;
+        MOID (SUB (q)) = yield;
         (void) genie_int_case (q);
         break;
       }
     }
   }
 // ESAC.
-  CLOSE_FRAME;
+  CLOSE_RANGE (SUB (SUB (p)));
   return GPROP (p);
 }
 
 //! @brief Execute united-case-clause.
 
-PROP_T genie_united_case (volatile NODE_T * p)
+PROP_T genie_united_case (NODE_T * p)
 {
-  volatile BOOL_T found_unit = A68_FALSE;
-  volatile MOID_T *um;
-  volatile ADDR_T pop_sp;
-  jmp_buf exit_buf;
-  volatile NODE_T *q = SUB (p);
-  volatile MOID_T *yield = MOID (q);
+  BOOL_T found_unit = A68_FALSE;
+  MOID_T *um;
+  ADDR_T pop_sp;
+  NODE_T *q = SUB (p);
+  MOID_T *yield = MOID (q);
 // CASE or OUSE.
-  OPEN_STATIC_FRAME ((NODE_T *) SUB (q));
-  INIT_GLOBAL_POINTER ((NODE_T *) SUB (q));
-  INIT_STATIC_FRAME ((NODE_T *) SUB (q));
+  OPEN_RANGE (SUB (q));
+  INIT_GLOBAL_POINTER (SUB (q));
   pop_sp = A68_SP;
   ENQUIRY_CLAUSE (NEXT_SUB (q));
   A68_SP = pop_sp;
-  um = (volatile MOID_T *) VALUE ((A68_UNION *) STACK_TOP);
+  um = VALUE ((A68_UNION *) STACK_TOP);
 // IN.
   FORWARD (q);
   if (um != NO_MOID) {
-    OPEN_STATIC_FRAME ((NODE_T *) SUB (q));
-    INIT_STATIC_FRAME ((NODE_T *) SUB (q));
-    found_unit = genie_united_case_unit (NEXT_SUB ((NODE_T *) q), (MOID_T *) um);
-    CLOSE_FRAME;
+    OPEN_RANGE (SUB (q));
+    found_unit = genie_united_case_unit (NEXT_SUB (q), um);
+    CLOSE_RANGE (SUB (q));
   } else {
     found_unit = A68_FALSE;
   }
@@ -2578,54 +2674,50 @@ PROP_T genie_united_case (volatile NODE_T * p)
     case CHOICE:
     case OUT_PART:
       {
-        OPEN_STATIC_FRAME ((NODE_T *) SUB (q));
-        INIT_STATIC_FRAME ((NODE_T *) SUB (q));
+        OPEN_RANGE (SUB (q));
         SERIAL_CLAUSE (NEXT_SUB (q));
-        CLOSE_FRAME;
+        CLOSE_RANGE (SUB (q));
         break;
       }
     case CLOSE_SYMBOL:
     case ESAC_SYMBOL:
       {
         if (yield != M_VOID) {
-          genie_push_undefined ((NODE_T *) q, (MOID_T *) yield);
+          genie_push_undefined (q, yield);
         }
         break;
       }
     default:
       {
-        MOID (SUB ((NODE_T *) q)) = (MOID_T *) yield;
+        MOID (SUB (q)) = yield;
         (void) genie_united_case (q);
         break;
       }
     }
   }
 // ESAC.
-  CLOSE_FRAME;
+  CLOSE_RANGE (SUB (SUB (p)));
   return GPROP (p);
 }
 
 //! @brief Execute conditional-clause.
 
-PROP_T genie_conditional (volatile NODE_T * p)
+PROP_T genie_conditional (NODE_T * p)
 {
-  volatile ADDR_T pop_sp = A68_SP;
-  jmp_buf exit_buf;
-  volatile NODE_T *q = SUB (p);
-  volatile MOID_T *yield = MOID (q);
+  ADDR_T pop_sp = A68_SP;
+  NODE_T *q = SUB (p);
+  MOID_T *yield = MOID (q);
 // IF or ELIF.
-  OPEN_STATIC_FRAME ((NODE_T *) SUB (q));
-  INIT_GLOBAL_POINTER ((NODE_T *) SUB (q));
-  INIT_STATIC_FRAME ((NODE_T *) SUB (q));
+  OPEN_RANGE (SUB (q));
+  INIT_GLOBAL_POINTER (SUB (q));
   ENQUIRY_CLAUSE (NEXT_SUB (q));
   A68_SP = pop_sp;
   FORWARD (q);
   if (VALUE ((A68_BOOL *) STACK_TOP) == A68_TRUE) {
 // THEN.
-    OPEN_STATIC_FRAME ((NODE_T *) SUB (q));
-    INIT_STATIC_FRAME ((NODE_T *) SUB (q));
+    OPEN_RANGE (SUB (q));
     SERIAL_CLAUSE (NEXT_SUB (q));
-    CLOSE_FRAME;
+    CLOSE_RANGE (SUB (q));
   } else {
 // ELSE.
     FORWARD (q);
@@ -2633,30 +2725,29 @@ PROP_T genie_conditional (volatile NODE_T * p)
     case CHOICE:
     case ELSE_PART:
       {
-        OPEN_STATIC_FRAME ((NODE_T *) SUB (q));
-        INIT_STATIC_FRAME ((NODE_T *) SUB (q));
+        OPEN_RANGE (SUB (q));
         SERIAL_CLAUSE (NEXT_SUB (q));
-        CLOSE_FRAME;
+        CLOSE_RANGE (SUB (q));
         break;
       }
     case CLOSE_SYMBOL:
     case FI_SYMBOL:
       {
         if (yield != M_VOID) {
-          genie_push_undefined ((NODE_T *) q, (MOID_T *) yield);
+          genie_push_undefined (q, yield);
         }
         break;
       }
     default:
       {
-        MOID (SUB ((NODE_T *) q)) = (MOID_T *) yield;
+        MOID (SUB (q)) = yield;
         (void) genie_conditional (q);
         break;
       }
     }
   }
 // FI.
-  CLOSE_FRAME;
+  CLOSE_RANGE (SUB (SUB (p)));
   return GPROP (p);
 }
 
@@ -2667,19 +2758,18 @@ PROP_T genie_conditional (volatile NODE_T * p)
 
 #define INCREMENT_COUNTER\
   if (!(for_part == NO_NODE && to_part == NO_NODE)) {\
-    CHECK_INT_ADDITION ((NODE_T *) p, counter, by);\
+    CHECK_INT_ADDITION (p, counter, by);\
     counter += by;\
   }
 
 //! @brief Execute loop-clause.
 
-PROP_T genie_loop (volatile NODE_T * p)
+PROP_T genie_loop (NODE_T * p)
 {
-  volatile ADDR_T pop_sp = A68_SP;
-  volatile INT_T from, by, to, counter;
-  volatile BOOL_T siga, conditional;
-  volatile NODE_T *for_part = NO_NODE, *to_part = NO_NODE, *q = NO_NODE;
-  jmp_buf exit_buf;
+  ADDR_T pop_sp = A68_SP;
+  INT_T from, by, to, counter;
+  BOOL_T siga, conditional;
+  NODE_T *for_part = NO_NODE, *to_part = NO_NODE, *q = NO_NODE;
 // FOR  identifier.
   if (IS (p, FOR_PART)) {
     for_part = NEXT_SUB (p);
@@ -2718,10 +2808,10 @@ PROP_T genie_loop (volatile NODE_T * p)
   }
   q = NEXT_SUB (p);
 // Here the loop part starts.
-// We open the frame only once and reinitialise if necessary
-  OPEN_STATIC_FRAME ((NODE_T *) q);
-  INIT_GLOBAL_POINTER ((NODE_T *) q);
-  INIT_STATIC_FRAME ((NODE_T *) q);
+// We open the frame only once and reinitialise if necessary;
+// a loop that declares nothing runs in the frame of its environ.
+  OPEN_RANGE (q);
+  INIT_GLOBAL_POINTER (q);
   counter = from;
 // Does the loop contain conditionals?.
   if (IS (p, WHILE_PART)) {
@@ -2751,11 +2841,10 @@ PROP_T genie_loop (volatile NODE_T * p)
         siga = (BOOL_T) (VALUE ((A68_BOOL *) STACK_TOP) != A68_FALSE);
       }
       if (siga) {
-        volatile NODE_T *do_part = p, *until_part;
+        NODE_T *do_part = p, *until_part;
         if (IS (p, WHILE_PART)) {
           do_part = NEXT_SUB (NEXT (p));
-          OPEN_STATIC_FRAME ((NODE_T *) do_part);
-          INIT_STATIC_FRAME ((NODE_T *) do_part);
+          OPEN_RANGE (do_part);
         } else {
           do_part = NEXT_SUB (p);
         }
@@ -2768,16 +2857,15 @@ PROP_T genie_loop (volatile NODE_T * p)
 // UNTIL part.
         if (until_part != NO_NODE && IS (until_part, UNTIL_PART)) {
           NODE_T *v = NEXT_SUB (until_part);
-          OPEN_STATIC_FRAME ((NODE_T *) v);
-          INIT_STATIC_FRAME ((NODE_T *) v);
+          OPEN_RANGE (v);
           A68_SP = pop_sp;
           ENQUIRY_CLAUSE (v);
           A68_SP = pop_sp;
           siga = (BOOL_T) (VALUE ((A68_BOOL *) STACK_TOP) == A68_FALSE);
-          CLOSE_FRAME;
+          CLOSE_RANGE (v);
         }
         if (IS (p, WHILE_PART)) {
-          CLOSE_FRAME;
+          CLOSE_RANGE (do_part);
         }
 // Increment counter.
         if (siga) {
@@ -2785,10 +2873,10 @@ PROP_T genie_loop (volatile NODE_T * p)
           siga = (BOOL_T) ((by > 0 && counter <= to) || (by < 0 && counter >= to) || (by == 0));
         }
 // The genie cannot take things to next iteration: re-initialise stack frame.
-        if (siga) {
+        if (siga && !FRAMELESS (TABLE (q))) {
           FRAME_CLEAR (AP_INCREMENT (TABLE (q)));
           if (INITIALISE_FRAME (TABLE (q))) {
-            initialise_frame ((NODE_T *) q);
+            initialise_frame (q);
           }
         }
       }
@@ -2807,16 +2895,16 @@ PROP_T genie_loop (volatile NODE_T * p)
       INCREMENT_COUNTER;
       siga = (BOOL_T) ((by > 0 && counter <= to) || (by < 0 && counter >= to) || (by == 0));
 // The genie cannot take things to next iteration: re-initialise stack frame.
-      if (siga) {
+      if (siga && !FRAMELESS (TABLE (q))) {
         FRAME_CLEAR (AP_INCREMENT (TABLE (q)));
         if (INITIALISE_FRAME (TABLE (q))) {
-          initialise_frame ((NODE_T *) q);
+          initialise_frame (q);
         }
       }
     }
   }
 // OD.
-  CLOSE_FRAME;
+  CLOSE_RANGE (q);
   A68_SP = pop_sp;
   return GPROP (p);
 }
@@ -2826,25 +2914,23 @@ PROP_T genie_loop (volatile NODE_T * p)
 
 //! @brief Execute closed clause.
 
-PROP_T genie_closed (volatile NODE_T * p)
+PROP_T genie_closed (NODE_T * p)
 {
-  jmp_buf exit_buf;
-  volatile NODE_T *q = NEXT_SUB (p);
-  OPEN_STATIC_FRAME ((NODE_T *) q);
-  INIT_GLOBAL_POINTER ((NODE_T *) q);
-  INIT_STATIC_FRAME ((NODE_T *) q);
+  NODE_T *q = NEXT_SUB (p);
+  OPEN_RANGE (q);
+  INIT_GLOBAL_POINTER (q);
   SERIAL_CLAUSE (q);
-  CLOSE_FRAME;
+  CLOSE_RANGE (q);
   return GPROP (p);
 }
 
 //! @brief Execute enclosed clause.
 
-PROP_T genie_enclosed (volatile NODE_T * p)
+PROP_T genie_enclosed (NODE_T * p)
 {
   PROP_T self;
   UNIT (&self) = (PROP_PROC *) genie_enclosed;
-  SOURCE (&self) = (NODE_T *) p;
+  SOURCE (&self) = p;
   switch (ATTRIBUTE (p)) {
   case PARTICULAR_PROGRAM:
     {
@@ -2858,54 +2944,54 @@ PROP_T genie_enclosed (volatile NODE_T * p)
     }
   case CLOSED_CLAUSE:
     {
-      self = genie_closed ((NODE_T *) p);
+      self = genie_closed (p);
       if (UNIT (&self) == genie_unit) {
         UNIT (&self) = (PROP_PROC *) genie_closed;
-        SOURCE (&self) = (NODE_T *) p;
+        SOURCE (&self) = p;
       }
       break;
     }
 #if defined (BUILD_PARALLEL_CLAUSE)
   case PARALLEL_CLAUSE:
     {
-      (void) genie_parallel ((NODE_T *) NEXT_SUB (p));
+      (void) genie_parallel (NEXT_SUB (p));
       break;
     }
 #endif
   case COLLATERAL_CLAUSE:
     {
-      (void) genie_collateral ((NODE_T *) p);
+      (void) genie_collateral (p);
       break;
     }
   case CONDITIONAL_CLAUSE:
     {
-      MOID (SUB ((NODE_T *) p)) = MOID (p);
+      MOID (SUB (p)) = MOID (p);
       (void) genie_conditional (p);
       UNIT (&self) = (PROP_PROC *) genie_conditional;
-      SOURCE (&self) = (NODE_T *) p;
+      SOURCE (&self) = p;
       break;
     }
   case CASE_CLAUSE:
     {
-      MOID (SUB ((NODE_T *) p)) = MOID (p);
+      MOID (SUB (p)) = MOID (p);
       (void) genie_int_case (p);
       UNIT (&self) = (PROP_PROC *) genie_int_case;
-      SOURCE (&self) = (NODE_T *) p;
+      SOURCE (&self) = p;
       break;
     }
   case CONFORMITY_CLAUSE:
     {
-      MOID (SUB ((NODE_T *) p)) = MOID (p);
+      MOID (SUB (p)) = MOID (p);
       (void) genie_united_case (p);
       UNIT (&self) = (PROP_PROC *) genie_united_case;
-      SOURCE (&self) = (NODE_T *) p;
+      SOURCE (&self) = p;
       break;
     }
   case LOOP_CLAUSE:
     {
-      (void) genie_loop (SUB ((NODE_T *) p));
+      (void) genie_loop (SUB (p));
       UNIT (&self) = (PROP_PROC *) genie_loop;
-      SOURCE (&self) = SUB ((NODE_T *) p);
+      SOURCE (&self) = SUB (p);
       break;
     }
   }
@@ -2992,6 +3078,11 @@ char *propagator_name (PROP_PROC * p)
   if (p == genie_formula) {
     return "genie_formula";
   }
+#if defined (HAVE_GSL)
+  if (p == genie_formula_torrix) {
+    return "genie_formula_torrix";
+  }
+#endif
   if (p == genie_generator) {
     return "genie_generator";
   }
@@ -81,37 +81,15 @@ void tax_format_texts (NODE_T *);
 
 int first_tag_global (TABLE_T * table, char *name)
 {
-  if (table != NO_TABLE) {
-    TAG_T *s = NO_TAG;
-    for (s = IDENTIFIERS (table); s != NO_TAG; FORWARD (s)) {
-      if (NSYMBOL (NODE (s)) == name) {
-        return IDENTIFIER;
-      }
-    }
-    for (s = INDICANTS (table); s != NO_TAG; FORWARD (s)) {
-      if (NSYMBOL (NODE (s)) == name) {
-        return INDICANT;
+  static int kinds[] = {IDENTIFIER, INDICANT, LABEL, OP_SYMBOL, PRIO_SYMBOL};
+  for (; table != NO_TABLE; table = PREVIOUS (table)) {
+    for (int k = 0; k < 5; k++) {
+      if (tag_index_first (table, kinds[k], name) != NO_TAG_INDEX) {
+        return kinds[k];
       }
     }
-    for (s = LABELS (table); s != NO_TAG; FORWARD (s)) {
-      if (NSYMBOL (NODE (s)) == name) {
-        return LABEL;
-      }
-    }
-    for (s = OPERATORS (table); s != NO_TAG; FORWARD (s)) {
-      if (NSYMBOL (NODE (s)) == name) {
-        return OP_SYMBOL;
-      }
-    }
-    for (s = PRIO (table); s != NO_TAG; FORWARD (s)) {
-      if (NSYMBOL (NODE (s)) == name) {
-        return PRIO_SYMBOL;
-      }
-    }
-    return first_tag_global (PREVIOUS (table), name);
-  } else {
-    return STOP;
   }
+  return STOP;
 }
 
 #define PORTCHECK_TAX(p, q) {\
@@ -452,9 +430,10 @@ void tax_generators (NODE_T * p)
 TAG_T *find_firmly_related_op (TABLE_T * c, char *n, MOID_T * l, MOID_T * r, TAG_T * self)
 {
   if (c != NO_TABLE) {
-    TAG_T *s = OPERATORS (c);
-    for (; s != NO_TAG; FORWARD (s)) {
-      if (s != self && NSYMBOL (NODE (s)) == n) {
+    TAG_INDEX_T *e = tag_index_first (c, OP_SYMBOL, n);
+    for (; e != NO_TAG_INDEX; e = tag_index_next (e)) {
+      TAG_T *s = TAX (e);
+      if (s != self) {
         PACK_T *t = PACK (MOID (s));
         if (t != NO_PACK && is_firm (MOID (t), l)) {
 // catch monadic operator.
@@ -530,7 +509,10 @@ void collect_taxes (NODE_T * p)
   bind_identifier_tag_to_symbol_table (p);
   bind_indicant_tag_to_symbol_table (p);
   test_firmly_related_ops (p);
-  test_firmly_related_ops_local (NO_NODE, OPERATORS (A68_STANDENV));
+// The standard environ does not change between runs, so only check it when testing a68g.
+  if (OPTION_REGRESSION_TEST (&A68_JOB)) {
+    test_firmly_related_ops_local (NO_NODE, OPERATORS (A68_STANDENV));
+  }
 }
 
 //! @brief Whether tag has already been declared in this range.
@@ -559,6 +541,109 @@ void already_declared_hidden (NODE_T * n, int a)
   }
 }
 
+// Symbol tables keep their tags in lists, which made identification
+// quadratic in the number of declarations in a range. The tag index hashes
+// a table, the kind of tag and its interned name to the tags with that name.
+// Entries are prepended like tags in the lists, so equal keys are found in
+// list order.
+
+//! @brief Bucket for a key in the tag index.
+
+static TAG_INDEX_T **tag_index_bucket (TABLE_T * s, int a, char *name)
+{
+  size_t h = ((size_t) s >> 4) * 0x9e3779b1 ^ ((size_t) name >> 3) * 0x85ebca6b ^ (size_t) a;
+  return &(A68_PARSER (tag_index)[h % (size_t) A68_PARSER (tag_index_size)]);
+}
+
+//! @brief Allocate an empty tag index of "n" buckets.
+
+static void new_tag_index (int n)
+{
+  A68_PARSER (tag_index) = (TAG_INDEX_T **) a68_alloc ((size_t) n * sizeof (TAG_INDEX_T *), __func__, __LINE__);
+  for (int k = 0; k < n; k++) {
+    A68_PARSER (tag_index)[k] = NO_TAG_INDEX;
+  }
+  A68_PARSER (tag_index_size) = n;
+}
+
+//! @brief Reset the tag index.
+
+void init_tag_index (void)
+{
+  a68_free (A68_PARSER (tag_index));
+  new_tag_index (TAG_INDEX_SIZE);
+  A68_PARSER (tag_index_count) = 0;
+}
+
+//! @brief Double the number of buckets in the tag index.
+
+static void grow_tag_index (void)
+{
+  TAG_INDEX_T **old = A68_PARSER (tag_index);
+  int n = A68_PARSER (tag_index_size);
+  new_tag_index (2 * n);
+  for (int k = 0; k < n; k++) {
+// Reverse the chain first, so equal keys keep their order.
+    TAG_INDEX_T *e = old[k], *r = NO_TAG_INDEX;
+    while (e != NO_TAG_INDEX) {
+      TAG_INDEX_T *f = NEXT (e);
+      NEXT (e) = r;
+      r = e;
+      e = f;
+    }
+    while (r != NO_TAG_INDEX) {
+      TAG_INDEX_T *f = NEXT (r), **b = tag_index_bucket (TABLE (r), ATTRIBUTE (r), TEXT (r));
+      NEXT (r) = *b;
+      *b = r;
+      r = f;
+    }
+  }
+  a68_free (old);
+}
+
+//! @brief Enter tag, that was just linked into list "a" of its table, in the tag index.
+
+void index_tag (TAG_T * z, int a)
+{
+  TAG_INDEX_T *e = (TAG_INDEX_T *) get_fixed_heap_space ((size_t) SIZE_ALIGNED (TAG_INDEX_T)), **b;
+  TABLE (e) = TAG_TABLE (z);
+  ATTRIBUTE (e) = a;
+  TEXT (e) = NSYMBOL (NODE (z));
+  TAX (e) = z;
+  b = tag_index_bucket (TABLE (e), a, TEXT (e));
+  NEXT (e) = *b;
+  *b = e;
+  if (++A68_PARSER (tag_index_count) > 2 * A68_PARSER (tag_index_size)) {
+    grow_tag_index ();
+  }
+}
+
+//! @brief First entry in the tag index for tags "a" named "name" in table "s".
+
+TAG_INDEX_T *tag_index_first (TABLE_T * s, int a, char *name)
+{
+  TAG_INDEX_T *e = *tag_index_bucket (s, a, name);
+  for (; e != NO_TAG_INDEX; FORWARD (e)) {
+    if (TEXT (e) == name && TABLE (e) == s && ATTRIBUTE (e) == a) {
+      return e;
+    }
+  }
+  return NO_TAG_INDEX;
+}
+
+//! @brief Next entry in the tag index with the same key as "e".
+
+TAG_INDEX_T *tag_index_next (TAG_INDEX_T * e)
+{
+  TAG_INDEX_T *f = NEXT (e);
+  for (; f != NO_TAG_INDEX; FORWARD (f)) {
+    if (TEXT (f) == TEXT (e) && TABLE (f) == TABLE (e) && ATTRIBUTE (f) == ATTRIBUTE (e)) {
+      return f;
+    }
+  }
+  return NO_TAG_INDEX;
+}
+
 //! @brief Add tag to local symbol table.
 
 TAG_T *add_tag (TABLE_T * s, int a, NODE_T * n, MOID_T * m, int p)
@@ -576,6 +661,7 @@ TAG_T *add_tag (TABLE_T * s, int a, NODE_T * n, MOID_T * m, int p)
         already_declared_hidden (n, IDENTIFIER);
         already_declared_hidden (n, LABEL);
         INSERT_TAG (&IDENTIFIERS (s), z);
+        index_tag (z, IDENTIFIER);
         break;
       }
     case INDICANT:{
@@ -583,23 +669,27 @@ TAG_T *add_tag (TABLE_T * s, int a, NODE_T * n, MOID_T * m, int p)
         already_declared (n, OP_SYMBOL);
         already_declared (n, PRIO_SYMBOL);
         INSERT_TAG (&INDICANTS (s), z);
+        index_tag (z, INDICANT);
         break;
       }
     case LABEL:{
         already_declared_hidden (n, LABEL);
         already_declared_hidden (n, IDENTIFIER);
         INSERT_TAG (&LABELS (s), z);
+        index_tag (z, LABEL);
         break;
       }
     case OP_SYMBOL:{
         already_declared (n, INDICANT);
         INSERT_TAG (&OPERATORS (s), z);
+        index_tag (z, OP_SYMBOL);
         break;
       }
     case PRIO_SYMBOL:{
         already_declared (n, PRIO_SYMBOL);
         already_declared (n, INDICANT);
         INSERT_TAG (&PRIO (s), z);
+        index_tag (z, PRIO_SYMBOL);
         break;
       }
     case ANONYMOUS:{
@@ -620,65 +710,28 @@ TAG_T *add_tag (TABLE_T * s, int a, NODE_T * n, MOID_T * m, int p)
 
 TAG_T *find_tag_global (TABLE_T * table, int a, char *name)
 {
-  if (table != NO_TABLE) {
-    TAG_T *s = NO_TAG;
-    switch (a) {
-    case IDENTIFIER:{
-        s = IDENTIFIERS (table);
-        break;
-      }
-    case INDICANT:{
-        s = INDICANTS (table);
-        break;
-      }
-    case LABEL:{
-        s = LABELS (table);
-        break;
-      }
-    case OP_SYMBOL:{
-        s = OPERATORS (table);
-        break;
-      }
-    case PRIO_SYMBOL:{
-        s = PRIO (table);
-        break;
-      }
-    default:{
-        ABEND (A68_TRUE, ERROR_INTERNAL_CONSISTENCY, __func__);
-        break;
-      }
+  ABEND (a != IDENTIFIER && a != INDICANT && a != LABEL && a != OP_SYMBOL && a != PRIO_SYMBOL, ERROR_INTERNAL_CONSISTENCY, __func__);
+  for (; table != NO_TABLE; table = PREVIOUS (table)) {
+    TAG_INDEX_T *e = tag_index_first (table, a, name);
+    if (e != NO_TAG_INDEX) {
+      return TAX (e);
     }
-    for (; s != NO_TAG; FORWARD (s)) {
-      if (NSYMBOL (NODE (s)) == name) {
-        return s;
-      }
-    }
-    return find_tag_global (PREVIOUS (table), a, name);
-  } else {
-    return NO_TAG;
   }
+  return NO_TAG;
 }
 
 //! @brief Whether identifier or label global.
 
 int is_identifier_or_label_global (TABLE_T * table, char *name)
 {
-  if (table != NO_TABLE) {
-    TAG_T *s;
-    for (s = IDENTIFIERS (table); s != NO_TAG; FORWARD (s)) {
-      if (NSYMBOL (NODE (s)) == name) {
-        return IDENTIFIER;
-      }
-    }
-    for (s = LABELS (table); s != NO_TAG; FORWARD (s)) {
-      if (NSYMBOL (NODE (s)) == name) {
-        return LABEL;
-      }
+  for (; table != NO_TABLE; table = PREVIOUS (table)) {
+    if (tag_index_first (table, IDENTIFIER, name) != NO_TAG_INDEX) {
+      return IDENTIFIER;
+    } else if (tag_index_first (table, LABEL, name) != NO_TAG_INDEX) {
+      return LABEL;
     }
-    return is_identifier_or_label_global (PREVIOUS (table), name);
-  } else {
-    return 0;
   }
+  return 0;
 }
 
 //! @brief Find a tag, searching only local symbol table.
@@ -686,24 +739,10 @@ int is_identifier_or_label_global (TABLE_T * table, char *name)
 TAG_T *find_tag_local (TABLE_T * table, int a, char *name)
 {
   if (table != NO_TABLE) {
-    TAG_T *s = NO_TAG;
-    if (a == OP_SYMBOL) {
-      s = OPERATORS (table);
-    } else if (a == PRIO_SYMBOL) {
-      s = PRIO (table);
-    } else if (a == IDENTIFIER) {
-      s = IDENTIFIERS (table);
-    } else if (a == INDICANT) {
-      s = INDICANTS (table);
-    } else if (a == LABEL) {
-      s = LABELS (table);
-    } else {
-      ABEND (A68_TRUE, ERROR_INTERNAL_CONSISTENCY, __func__);
-    }
-    for (; s != NO_TAG; FORWARD (s)) {
-      if (NSYMBOL (NODE (s)) == name) {
-        return s;
-      }
+    ABEND (a != IDENTIFIER && a != INDICANT && a != LABEL && a != OP_SYMBOL && a != PRIO_SYMBOL, ERROR_INTERNAL_CONSISTENCY, __func__);
+    TAG_INDEX_T *e = tag_index_first (table, a, name);
+    if (e != NO_TAG_INDEX) {
+      return TAX (e);
     }
   }
   return NO_TAG;
@@ -720,12 +720,14 @@ TABLE_T *new_symbol_table (TABLE_T * p)
   TABLE_T *z = (TABLE_T *) get_fixed_heap_space ((size_t) SIZE_ALIGNED (TABLE_T));
   NUM (z) = A68 (symbol_table_count);
   LEVEL (z) = A68 (symbol_table_count)++;
+  DEPTH (z) = 0;
   NEST (z) = A68 (symbol_table_count);
   ATTRIBUTE (z) = 0;
   AP_INCREMENT (z) = 0;
   INITIALISE_FRAME (z) = A68_TRUE;
   PROC_OPS (z) = A68_TRUE;
   INITIALISE_ANON (z) = A68_TRUE;
+  FRAMELESS (z) = A68_FALSE;
   PREVIOUS (z) = p;
   OUTER (z) = NO_TABLE;
   IDENTIFIERS (z) = NO_TAG;
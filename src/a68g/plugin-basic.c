@@ -189,6 +189,21 @@ BOOL_T basic_slice (NODE_T * p)
   return A68_FALSE;
 }
 
+//! @brief Whether basic selection.
+
+BOOL_T basic_selection (NODE_T * p)
+{
+// The structure may have fields of any mode; only the selected one matters.
+  ADDR_T offset = 0;
+  char *path;
+  if (IS (p, SELECTION) && selection_root (p, &offset, &path) != NO_NODE) {
+    MOID_T *m = MOID (p);
+    return primitive_mode (IS_REF (m) ? SUB (m) : m);
+  } else {
+    return A68_FALSE;
+  }
+}
+
 //! @brief Whether basic argument.
 
 BOOL_T basic_argument (NODE_T * p)
@@ -329,7 +344,7 @@ BOOL_T basic_unit (NODE_T * p)
     } else if (IS (p, VOIDING) && IS (SUB (p), ASSIGNATION) && stems_from (SUB_SUB (p), SELECTION) != NO_NODE) {
       NODE_T *dst = SUB_SUB (p);
       NODE_T *src = NEXT_NEXT (dst);
-      return (BOOL_T) (stems_from (NEXT_SUB (stems_from (dst, SELECTION)), IDENTIFIER) != NO_NODE && basic_unit (src) && basic_mode_non_row (MOID (dst)));
+      return (BOOL_T) (basic_selection (stems_from (dst, SELECTION)) && basic_unit (src) && basic_mode_non_row (MOID (dst)));
     } else if (IS (p, VOIDING)) {
       return basic_unit (SUB (p));
     } else if (IS (p, DEREFERENCING) && stems_from (SUB (p), SLICE)) {
@@ -350,12 +365,7 @@ BOOL_T basic_unit (NODE_T * p)
     } else if (IS (p, SLICE)) {
       return (BOOL_T) (basic_mode (MOID (p)) && basic_slice (p));
     } else if (IS (p, SELECTION)) {
-      NODE_T *sec = stems_from (NEXT_SUB (p), IDENTIFIER);
-      if (sec == NO_NODE) {
-        return A68_FALSE;
-      } else {
-        return basic_mode_non_row (MOID (sec));
-      }
+      return basic_selection (p);
     } else if (IS (p, IDENTITY_RELATION)) {
 #define GOOD(p) (stems_from (p, IDENTIFIER) != NO_NODE && IS (MOID (stems_from ((p), IDENTIFIER)), REF_SYMBOL))
       NODE_T *lhs = SUB (p);
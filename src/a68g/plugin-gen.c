@@ -637,10 +637,10 @@ char *gen_voiding_assignation_selection (NODE_T * p, FILE_T out, int compose_fun
   NODE_T *src = NEXT_NEXT (dst);
   if (BASIC (dst, SELECTION) && basic_unit (src) && basic_mode_non_row (MOID (dst))) {
     NODE_T *field = SUB (stems_from (dst, SELECTION));
-    NODE_T *sec = NEXT (field);
-    NODE_T *idf = stems_from (sec, IDENTIFIER);
+    ADDR_T offset = 0;
+    char *field_idf;
+    NODE_T *idf = selection_root (dst, &offset, &field_idf);
     char sel[NAME_SIZE], ref[NAME_SIZE], pop[NAME_SIZE];
-    char *field_idf = NSYMBOL (SUB (field));
     static char fn[NAME_SIZE];
     comment_source (p, out);
     (void) make_name (pop, PUP, "", NUMBER (p));
@@ -668,7 +668,7 @@ char *gen_voiding_assignation_selection (NODE_T * p, FILE_T out, int compose_fun
 // Initialise.
     if (signed_in (BOOK_DECL, L_EXECUTE, NSYMBOL (idf)) == NO_BOOK) {
       get_stack (idf, out, ref, "A68_REF");
-      indentf (out, snprintf (A68 (edit_line), SNPRINTF_SIZE, "%s = (%s *) & (ADDRESS (%s)[" A68_LU "]);\n", sel, inline_mode (SUB_MOID (field)), ref, OFFSET_OFF (field)));
+      indentf (out, snprintf (A68 (edit_line), SNPRINTF_SIZE, "%s = (%s *) & (ADDRESS (%s)[" A68_LU "]);\n", sel, inline_mode (SUB_MOID (field)), ref, offset));
       sign_in (BOOK_DECL, L_EXECUTE, NSYMBOL (idf), (void *) field_idf, NUMBER (field));
     }
     inline_unit (src, out, L_EXECUTE);
@@ -739,6 +739,9 @@ char *gen_voiding_assignation_slice (NODE_T * p, FILE_T out, int compose_fun)
       NODE_T *pidf = stems_from (prim, IDENTIFIER);
       get_stack (pidf, out, idf, "A68_REF");
       indentf (out, snprintf (A68 (edit_line), SNPRINTF_SIZE, "GET_DESCRIPTOR (%s, %s, DEREF (A68_ROW, %s));\n", arr, tup, idf));
+      if (mode == M_CHAR) {
+        indentf (out, snprintf (A68 (edit_line), SNPRINTF_SIZE, "UNPACK_ROW (_NODE_ (%d), %s, %s, DEREF (A68_ROW, %s))\n", NUMBER (p), arr, tup, idf));
+      }
       indentf (out, snprintf (A68 (edit_line), SNPRINTF_SIZE, "%s = ARRAY (%s);\n", elm, arr));
       sign_in (BOOK_DECL, L_EXECUTE, NSYMBOL (p), (void *) indx, NUMBER (prim));
     }
@@ -370,6 +370,9 @@ void inline_dereference_slice (NODE_T * p, FILE_T out, int phase)
       get_stack (pidf, out, idf, "A68_REF");
       if (IS (row_mode, REF_SYMBOL) && IS (SUB (row_mode), ROW_SYMBOL)) {
         indentf (out, snprintf (A68 (edit_line), SNPRINTF_SIZE, "GET_DESCRIPTOR (%s, %s, DEREF (A68_ROW, %s));\n", arr, tup, idf));
+        if (mode == M_CHAR) {
+          indentf (out, snprintf (A68 (edit_line), SNPRINTF_SIZE, "UNPACK_ROW (_NODE_ (%d), %s, %s, DEREF (A68_ROW, %s))\n", NUMBER (p), arr, tup, idf));
+        }
       } else {
         ABEND (A68_TRUE, ERROR_INTERNAL_CONSISTENCY, __func__);
       }
@@ -454,6 +457,9 @@ void inline_slice_ref_to_ref (NODE_T * p, FILE_T out, int phase)
       get_stack (pidf, out, idf, "A68_REF");
       if (IS (row_mode, REF_SYMBOL) && IS (SUB (row_mode), ROW_SYMBOL)) {
         indentf (out, snprintf (A68 (edit_line), SNPRINTF_SIZE, "GET_DESCRIPTOR (%s, %s, DEREF (A68_ROW, %s));\n", arr, tup, idf));
+        if (mode == M_CHAR) {
+          indentf (out, snprintf (A68 (edit_line), SNPRINTF_SIZE, "UNPACK_ROW (_NODE_ (%d), %s, %s, DEREF (A68_ROW, %s))\n", NUMBER (p), arr, tup, idf));
+        }
       } else {
         ABEND (A68_TRUE, ERROR_INTERNAL_CONSISTENCY, __func__);
       }
@@ -525,8 +531,14 @@ void inline_slice (NODE_T * p, FILE_T out, int phase)
       get_stack (pidf, out, idf, "A68_REF");
       if (IS (row_mode, REF_SYMBOL)) {
         indentf (out, snprintf (A68 (edit_line), SNPRINTF_SIZE, "GET_DESCRIPTOR (%s, %s, DEREF (A68_ROW, %s));\n", arr, tup, idf));
+        if (mode == M_CHAR) {
+          indentf (out, snprintf (A68 (edit_line), SNPRINTF_SIZE, "UNPACK_ROW (_NODE_ (%d), %s, %s, DEREF (A68_ROW, %s))\n", NUMBER (p), arr, tup, idf));
+        }
       } else {
         indentf (out, snprintf (A68 (edit_line), SNPRINTF_SIZE, "GET_DESCRIPTOR (%s, %s, (A68_ROW *) %s);\n", arr, tup, idf));
+        if (mode == M_CHAR) {
+          indentf (out, snprintf (A68 (edit_line), SNPRINTF_SIZE, "UNPACK_ROW (_NODE_ (%d), %s, %s, (A68_ROW *) %s)\n", NUMBER (p), arr, tup, idf));
+        }
       }
       sign_in (BOOK_DECL, L_EXECUTE, NSYMBOL (p), (void *) indx, NUMBER (prim));
     } else if (same_tree (indx, (NODE_T *) (INFO (entry))) == A68_FALSE) {
@@ -868,10 +880,10 @@ void inline_conditional (NODE_T * p, FILE_T out, int phase)
 void inline_dereference_selection (NODE_T * p, FILE_T out, int phase)
 {
   NODE_T *field = SUB (p);
-  NODE_T *sec = NEXT (field);
-  NODE_T *idf = stems_from (sec, IDENTIFIER);
+  ADDR_T offset = 0;
+  char *field_idf;
+  NODE_T *idf = selection_root (p, &offset, &field_idf);
   char ref[NAME_SIZE], sel[NAME_SIZE];
-  char *field_idf = NSYMBOL (SUB (field));
   if (phase == L_DECLARE) {
     BOOK_T *entry = signed_in (BOOK_DECL, L_DECLARE, NSYMBOL (idf));
     if (entry == NO_BOOK) {
@@ -884,7 +896,7 @@ void inline_dereference_selection (NODE_T * p, FILE_T out, int phase)
       (void) add_declaration (&A68_OPT (root_idf), inline_mode (SUB_MOID (field)), 1, sel);
       sign_in (BOOK_DECL, L_DECLARE, NSYMBOL (idf), (void *) field_idf, NUMBER (field));
     }
-    inline_unit (sec, out, L_DECLARE);
+    inline_unit (idf, out, L_DECLARE);
   } else if (phase == L_EXECUTE) {
     BOOK_T *entry = signed_in (BOOK_DECL, L_EXECUTE, NSYMBOL (idf));
     if (entry == NO_BOOK) {
@@ -895,15 +907,15 @@ void inline_dereference_selection (NODE_T * p, FILE_T out, int phase)
     if (entry == NO_BOOK) {
       (void) make_name (ref, NSYMBOL (idf), "", NUMBER (field));
       (void) make_name (sel, SEL, "", NUMBER (field));
-      indentf (out, snprintf (A68 (edit_line), SNPRINTF_SIZE, "%s = (%s *) & (ADDRESS (%s)[" A68_LU "]);\n", sel, inline_mode (SUB_MOID (field)), ref, OFFSET_OFF (field)));
+      indentf (out, snprintf (A68 (edit_line), SNPRINTF_SIZE, "%s = (%s *) & (ADDRESS (%s)[" A68_LU "]);\n", sel, inline_mode (SUB_MOID (field)), ref, offset));
       sign_in (BOOK_DECL, L_EXECUTE, NSYMBOL (idf), (void *) field_idf, NUMBER (field));
     } else if (field_idf != (char *) (INFO (entry))) {
       (void) make_name (ref, NSYMBOL (idf), "", NUMBER (entry));
       (void) make_name (sel, SEL, "", NUMBER (field));
-      indentf (out, snprintf (A68 (edit_line), SNPRINTF_SIZE, "%s = (%s *) & (ADDRESS (%s)[" A68_LU "]);\n", sel, inline_mode (SUB_MOID (field)), ref, OFFSET_OFF (field)));
+      indentf (out, snprintf (A68 (edit_line), SNPRINTF_SIZE, "%s = (%s *) & (ADDRESS (%s)[" A68_LU "]);\n", sel, inline_mode (SUB_MOID (field)), ref, offset));
       sign_in (BOOK_DECL, L_EXECUTE, NSYMBOL (idf), (void *) field_idf, NUMBER (field));
     }
-    inline_unit (sec, out, L_EXECUTE);
+    inline_unit (idf, out, L_EXECUTE);
   } else if (phase == L_YIELD) {
     BOOK_T *entry = signed_in (BOOK_DECL, L_EXECUTE, NSYMBOL (idf));
     if (entry != NO_BOOK && (char *) (INFO (entry)) == field_idf) {
@@ -928,10 +940,10 @@ void inline_dereference_selection (NODE_T * p, FILE_T out, int phase)
 void inline_selection (NODE_T * p, FILE_T out, int phase)
 {
   NODE_T *field = SUB (p);
-  NODE_T *sec = NEXT (field);
-  NODE_T *idf = stems_from (sec, IDENTIFIER);
+  ADDR_T offset = 0;
+  char *field_idf;
+  NODE_T *idf = selection_root (p, &offset, &field_idf);
   char ref[NAME_SIZE], sel[NAME_SIZE];
-  char *field_idf = NSYMBOL (SUB (field));
   if (phase == L_DECLARE) {
     BOOK_T *entry = signed_in (BOOK_DECL, L_DECLARE, NSYMBOL (idf));
     if (entry == NO_BOOK) {
@@ -944,22 +956,22 @@ void inline_selection (NODE_T * p, FILE_T out, int phase)
       (void) add_declaration (&A68_OPT (root_idf), inline_mode (MOID (field)), 1, sel);
       sign_in (BOOK_DECL, L_DECLARE, NSYMBOL (idf), (void *) field_idf, NUMBER (field));
     }
-    inline_unit (sec, out, L_DECLARE);
+    inline_unit (idf, out, L_DECLARE);
   } else if (phase == L_EXECUTE) {
     BOOK_T *entry = signed_in (BOOK_DECL, L_EXECUTE, NSYMBOL (idf));
     if (entry == NO_BOOK) {
       (void) make_name (ref, NSYMBOL (idf), "", NUMBER (field));
       get_stack (idf, out, ref, "BYTE_T");
       (void) make_name (sel, SEL, "", NUMBER (field));
-      indentf (out, snprintf (A68 (edit_line), SNPRINTF_SIZE, "%s = (%s *) & (%s[" A68_LU "]);\n", sel, inline_mode (MOID (field)), ref, OFFSET_OFF (field)));
+      indentf (out, snprintf (A68 (edit_line), SNPRINTF_SIZE, "%s = (%s *) & (%s[" A68_LU "]);\n", sel, inline_mode (MOID (field)), ref, offset));
       sign_in (BOOK_DECL, L_EXECUTE, NSYMBOL (idf), (void *) field_idf, NUMBER (field));
     } else if (field_idf != (char *) (INFO (entry))) {
       (void) make_name (ref, NSYMBOL (idf), "", NUMBER (entry));
       (void) make_name (sel, SEL, "", NUMBER (field));
-      indentf (out, snprintf (A68 (edit_line), SNPRINTF_SIZE, "%s = (%s *) & (%s[" A68_LU "]);\n", sel, inline_mode (MOID (field)), ref, OFFSET_OFF (field)));
+      indentf (out, snprintf (A68 (edit_line), SNPRINTF_SIZE, "%s = (%s *) & (%s[" A68_LU "]);\n", sel, inline_mode (MOID (field)), ref, offset));
       sign_in (BOOK_DECL, L_EXECUTE, NSYMBOL (idf), (void *) field_idf, NUMBER (field));
     }
-    inline_unit (sec, out, L_EXECUTE);
+    inline_unit (idf, out, L_EXECUTE);
   } else if (phase == L_YIELD) {
     BOOK_T *entry = signed_in (BOOK_DECL, L_EXECUTE, NSYMBOL (idf));
     if (entry != NO_BOOK && (char *) (INFO (entry)) == field_idf) {
@@ -980,10 +992,10 @@ void inline_selection (NODE_T * p, FILE_T out, int phase)
 void inline_selection_ref_to_ref (NODE_T * p, FILE_T out, int phase)
 {
   NODE_T *field = SUB (p);
-  NODE_T *sec = NEXT (field);
-  NODE_T *idf = stems_from (sec, IDENTIFIER);
+  ADDR_T offset = 0;
+  char *field_idf;
+  NODE_T *idf = selection_root (p, &offset, &field_idf);
   char ref[NAME_SIZE], sel[NAME_SIZE];
-  char *field_idf = NSYMBOL (SUB (field));
   if (phase == L_DECLARE) {
     BOOK_T *entry = signed_in (BOOK_DECL, L_DECLARE, NSYMBOL (idf));
     if (entry == NO_BOOK) {
@@ -996,7 +1008,7 @@ void inline_selection_ref_to_ref (NODE_T * p, FILE_T out, int phase)
       (void) add_declaration (&A68_OPT (root_idf), "A68_REF", 0, sel);
       sign_in (BOOK_DECL, L_DECLARE, NSYMBOL (idf), (void *) field_idf, NUMBER (field));
     }
-    inline_unit (sec, out, L_DECLARE);
+    inline_unit (idf, out, L_DECLARE);
   } else if (phase == L_EXECUTE) {
     BOOK_T *entry = signed_in (BOOK_DECL, L_EXECUTE_2, NSYMBOL (idf));
     if (entry == NO_BOOK) {
@@ -1010,8 +1022,8 @@ void inline_selection_ref_to_ref (NODE_T * p, FILE_T out, int phase)
       sign_in (BOOK_DECL, L_EXECUTE_2, NSYMBOL (idf), (void *) field_idf, NUMBER (field));
     }
     indentf (out, snprintf (A68 (edit_line), SNPRINTF_SIZE, "%s = *%s;\n", sel, ref));
-    indentf (out, snprintf (A68 (edit_line), SNPRINTF_SIZE, "OFFSET (&%s) += " A68_LU ";\n", sel, OFFSET_OFF (field)));
-    inline_unit (sec, out, L_EXECUTE);
+    indentf (out, snprintf (A68 (edit_line), SNPRINTF_SIZE, "OFFSET (&%s) += " A68_LU ";\n", sel, offset));
+    inline_unit (idf, out, L_EXECUTE);
   } else if (phase == L_YIELD) {
     BOOK_T *entry = signed_in (BOOK_DECL, L_EXECUTE, NSYMBOL (idf));
     if (entry != NO_BOOK && (char *) (INFO (entry)) == field_idf) {
@@ -32,25 +32,44 @@
 
 #if defined (BUILD_A68_COMPILER)
 
-//! @brief Build shell script from program.
+//! @brief Copy file "from" to file "to".
 
-void build_script (void)
+static BOOL_T copy_file (char *from, char *to)
 {
-  int ret;
-  FILE_T script, source;
+  FILE_T in, out;
+  char buf[BUFFER_SIZE];
+  ssize_t n = 0;
+  BOOL_T ok = A68_TRUE;
+  in = open (from, O_RDONLY);
+  if (in == -1) {
+    return A68_FALSE;
+  }
+  out = open (to, O_WRONLY | O_CREAT | O_TRUNC, A68_PROTECTION);
+  if (out == -1) {
+    ASSERT (close (in) == 0);
+    return A68_FALSE;
+  }
+  while (ok && (n = io_read (in, buf, BUFFER_SIZE)) > 0) {
+    ok = (io_write (out, buf, (size_t) n) == n);
+  }
+  ok = ok && (n == 0);
+  ASSERT (close (in) == 0);
+  if (close (out) != 0) {
+    ok = A68_FALSE;
+  }
+  return ok;
+}
+
+//! @brief Flatten the source file, with its includes, into file "name".
+
+static void flatten_source (char *name)
+{
+  FILE_T source;
   LINE_T *sl;
   BUFFER cmd;
   BUFCLR (cmd);
-  char *strop;
-#if !defined (BUILD_A68_COMPILER)
-  return;
-#endif
-  announce_phase ("script builder");
-  ABEND (OPTION_OPT_LEVEL (&A68_JOB) == 0, ERROR_ACTION, __func__);
-// Flatten the source file.
-  ASSERT (snprintf (cmd, SNPRINTF_SIZE, "%s.%s", HIDDEN_TEMP_FILE_NAME, FILE_SOURCE_NAME (&A68_JOB)) >= 0);
-  source = open (cmd, O_WRONLY | O_CREAT | O_TRUNC, A68_PROTECTION);
-  ABEND (source == -1, ERROR_ACTION, cmd);
+  source = open (name, O_WRONLY | O_CREAT | O_TRUNC, A68_PROTECTION);
+  ABEND (source == -1, ERROR_ACTION, name);
   for (sl = TOP_LINE (&A68_JOB); sl != NO_LINE; FORWARD (sl)) {
     if (strlen (STRING (sl)) == 0 || (STRING (sl))[strlen (STRING (sl)) - 1] != NEWLINE_CHAR) {
       ASSERT (snprintf (cmd, SNPRINTF_SIZE, "%s\n%d\n%s\n", FILENAME (sl), NUMBER (sl), STRING (sl)) >= 0);
@@ -60,10 +79,38 @@ void build_script (void)
     WRITE (source, cmd);
   }
   ASSERT (close (source) == 0);
+}
+
+//! @brief Options that a script or executable runs with.
+
+static void script_options (char *options)
+{
+// The plugin is loaded into a rerun of the code generator, which must make the
+// same choices as when the plugin was built, also about runtime checks.
+  ASSERT (snprintf (options, SNPRINTF_SIZE, "%s%s%s", optimisation_option (), (OPTION_COMPILE_CHECK (&A68_JOB) ? " --error-check" : ""), (OPTION_STROPPING (&A68_JOB) == QUOTE_STROPPING ? " --quote-stropping" : "")) >= 0);
+}
+
+//! @brief Build shell script from program.
+
+void build_script (void)
+{
+  int ret;
+  FILE_T script;
+  BUFFER cmd, options;
+  BUFCLR (cmd);
+  BUFCLR (options);
+  char *strop;
+#if !defined (BUILD_A68_COMPILER)
+  return;
+#endif
+  announce_phase ("script builder");
+  ABEND (OPTION_OPT_LEVEL (&A68_JOB) == 0, ERROR_ACTION, __func__);
+// Flatten the source file.
+  ASSERT (snprintf (cmd, SNPRINTF_SIZE, "%s.%s", HIDDEN_TEMP_FILE_NAME, FILE_SOURCE_NAME (&A68_JOB)) >= 0);
+  flatten_source (cmd);
 // Compress source and dynamic library.
-  ASSERT (snprintf (cmd, SNPRINTF_SIZE, "cp %s %s.%s", FILE_PLUGIN_NAME (&A68_JOB), HIDDEN_TEMP_FILE_NAME, FILE_PLUGIN_NAME (&A68_JOB)) >= 0);
-  ret = system (cmd);
-  ABEND (ret != 0, ERROR_ACTION, cmd);
+  ASSERT (snprintf (cmd, SNPRINTF_SIZE, "%s.%s", HIDDEN_TEMP_FILE_NAME, FILE_PLUGIN_NAME (&A68_JOB)) >= 0);
+  ABEND (!copy_file (FILE_PLUGIN_NAME (&A68_JOB), cmd), ERROR_ACTION, cmd);
   ASSERT (snprintf (cmd, SNPRINTF_SIZE, "tar czf %s.%s.tgz %s.%s %s.%s", HIDDEN_TEMP_FILE_NAME, FILE_GENERIC_NAME (&A68_JOB), HIDDEN_TEMP_FILE_NAME, FILE_SOURCE_NAME (&A68_JOB), HIDDEN_TEMP_FILE_NAME, FILE_PLUGIN_NAME (&A68_JOB)) >= 0);
   ret = system (cmd);
   ABEND (ret != 0, ERROR_ACTION, cmd);
@@ -79,7 +126,8 @@ void build_script (void)
   }
   ASSERT (snprintf (A68 (output_line), SNPRINTF_SIZE, "#! %s/a68g %s\n", BINDIR, strop) >= 0);
   WRITE (script, A68 (output_line));
-  ASSERT (snprintf (A68 (output_line), SNPRINTF_SIZE, "%s\n%s --verify \"%s\"\n", FILE_GENERIC_NAME (&A68_JOB), optimisation_option (), PACKAGE_STRING) >= 0);
+  script_options (options);
+  ASSERT (snprintf (A68 (output_line), SNPRINTF_SIZE, "%s\n%s --verify \"%s\"\n", FILE_GENERIC_NAME (&A68_JOB), options, PACKAGE_STRING) >= 0);
   WRITE (script, A68 (output_line));
   ASSERT (close (script) == 0);
   ASSERT (snprintf (cmd, SNPRINTF_SIZE, "cat %s.%s %s.%s.tgz > %s", HIDDEN_TEMP_FILE_NAME, FILE_SCRIPT_NAME (&A68_JOB), HIDDEN_TEMP_FILE_NAME, FILE_GENERIC_NAME (&A68_JOB), FILE_SCRIPT_NAME (&A68_JOB)) >= 0);
@@ -144,11 +192,181 @@ void load_script (void)
     A68 (input_line)[k++] = ch;
     ASSERT (io_read (script, &ch, 1) == 1);
   }
+  OPTION_COMPILE_CHECK (&A68_JOB) = A68_FALSE;
   isolate_options (A68 (input_line), NO_LINE);
   (void) set_options (OPTION_LIST (&A68_JOB), A68_FALSE);
   ASSERT (close (script) == 0);
 }
 
+// A standalone executable is a copy of the running a68g image, followed by the
+// flattened source, the plugin and a trailer that records their sizes.
+// At startup a68g inspects its own image. When it finds a trailer, it unpacks
+// the program into a private directory under $TMPDIR and runs it like a script,
+// so neither an installed a68g nor tar and sed are needed. The program is still
+// scanned, parsed and checked at every start.
+
+#define EXECUTABLE_MAGIC "a68g executable"
+
+typedef struct EXECUTABLE_T EXECUTABLE_T;
+
+struct EXECUTABLE_T
+{
+  char magic[SMALL_BUFFER_SIZE], name[SMALL_BUFFER_SIZE], options[SMALL_BUFFER_SIZE];
+  long long unt source_size, plugin_size;
+};
+
+//! @brief Append file "from" to open file "out", return the number of bytes.
+
+static long long unt append_file (FILE_T out, char *from)
+{
+  FILE_T in = open (from, O_RDONLY | O_BINARY);
+  char buf[BUFFER_SIZE];
+  long long unt size = 0;
+  ssize_t n;
+  ABEND (in == -1, ERROR_ACTION, from);
+  while ((n = io_read (in, buf, BUFFER_SIZE)) > 0) {
+    ABEND (io_write (out, buf, (size_t) n) != n, ERROR_ACTION, from);
+    size += (long long unt) n;
+  }
+  ABEND (n < 0, ERROR_ACTION, from);
+  ASSERT (close (in) == 0);
+  return size;
+}
+
+//! @brief Copy "size" bytes from open file "in" to file "to".
+
+static void extract_file (FILE_T in, long long unt size, char *to)
+{
+  FILE_T out = open (to, O_WRONLY | O_CREAT | O_TRUNC | O_BINARY, A68_PROTECTION);
+  char buf[BUFFER_SIZE];
+  ABEND (out == -1, ERROR_ACTION, to);
+  while (size > 0) {
+    size_t chunk = (size < BUFFER_SIZE ? (size_t) size : BUFFER_SIZE);
+    ABEND (io_read (in, buf, chunk) != (ssize_t) chunk, ERROR_ACTION, to);
+    ABEND (io_write (out, buf, chunk) != (ssize_t) chunk, ERROR_ACTION, to);
+    size -= chunk;
+  }
+  ASSERT (close (out) == 0);
+}
+
+//! @brief Build standalone executable from program.
+
+void build_executable (void)
+{
+  FILE_T exe;
+  EXECUTABLE_T trailer;
+  BUFFER source;
+  char *base;
+  BUFCLR (source);
+  announce_phase ("executable builder");
+  ABEND (OPTION_OPT_LEVEL (&A68_JOB) == 0, ERROR_ACTION, __func__);
+  memset (&trailer, 0, sizeof (trailer));
+  bufcpy (trailer.magic, EXECUTABLE_MAGIC, SMALL_BUFFER_SIZE);
+  bufcpy (trailer.name, FILE_GENERIC_NAME (&A68_JOB), SMALL_BUFFER_SIZE);
+  script_options (source);
+  bufcpy (trailer.options, source, SMALL_BUFFER_SIZE);
+// The flattened source goes next to the source, which may be in another directory.
+  base = strrchr (FILE_SOURCE_NAME (&A68_JOB), '/');
+  base = (base == NO_TEXT ? FILE_SOURCE_NAME (&A68_JOB) : &base[1]);
+  ASSERT (snprintf (source, SNPRINTF_SIZE, "%s/%s.%s", FILE_PATH (&A68_JOB), HIDDEN_TEMP_FILE_NAME, base) >= 0);
+  flatten_source (source);
+// Image, source, plugin and trailer.
+  exe = open (FILE_SCRIPT_NAME (&A68_JOB), O_WRONLY | O_CREAT | O_TRUNC | O_BINARY, A68_PROTECTION | S_IXUSR | S_IXGRP | S_IXOTH);
+  ABEND (exe == -1, ERROR_ACTION, FILE_SCRIPT_NAME (&A68_JOB));
+  (void) append_file (exe, "/proc/self/exe");
+  trailer.source_size = append_file (exe, source);
+  trailer.plugin_size = append_file (exe, FILE_PLUGIN_NAME (&A68_JOB));
+  ABEND (io_write (exe, &trailer, sizeof (trailer)) != (ssize_t) sizeof (trailer), ERROR_ACTION, FILE_SCRIPT_NAME (&A68_JOB));
+  ASSERT (close (exe) == 0);
+  ABEND (chmod (FILE_SCRIPT_NAME (&A68_JOB), (__mode_t) (S_IRUSR | S_IWUSR | S_IXUSR | S_IRGRP | S_IXGRP | S_IROTH | S_IXOTH)) != 0, ERROR_ACTION, FILE_SCRIPT_NAME (&A68_JOB));
+  ABEND (remove (source) != 0, ERROR_ACTION, source);
+}
+
+// Directory where an executable unpacks its program.
+
+static BUFFER executable_dir = "";
+
+//! @brief Remove the directory where an executable unpacked its program.
+
+void remove_executable_dir (void)
+{
+  DIR *dir;
+  struct dirent *entry;
+  BUFFER file;
+  if (strlen (executable_dir) == 0) {
+    return;
+  }
+  dir = opendir (executable_dir);
+  if (dir != NULL) {
+    while ((entry = readdir (dir)) != NULL) {
+      if (strcmp (entry->d_name, ".") != 0 && strcmp (entry->d_name, "..") != 0) {
+        ASSERT (snprintf (file, SNPRINTF_SIZE, "%s/%s", executable_dir, entry->d_name) >= 0);
+        (void) remove (file);
+      }
+    }
+    (void) closedir (dir);
+  }
+  (void) rmdir (executable_dir);
+  executable_dir[0] = NULL_CHAR;
+  errno = 0;
+}
+
+//! @brief Load program appended to the running image, if any.
+
+BOOL_T load_executable (void)
+{
+  FILE_T exe;
+  EXECUTABLE_T trailer;
+  off_t end;
+  char *base, *tmp;
+  BUFFER name, file;
+  BUFCLR (name);
+  BUFCLR (file);
+  exe = open ("/proc/self/exe", O_RDONLY | O_BINARY);
+  if (exe == -1) {
+    errno = 0;
+    return A68_FALSE;
+  }
+  end = lseek (exe, -(off_t) sizeof (trailer), SEEK_END);
+  if (end < 0 || io_read (exe, &trailer, sizeof (trailer)) != (ssize_t) sizeof (trailer) || strcmp (trailer.magic, EXECUTABLE_MAGIC) != 0) {
+    ASSERT (close (exe) == 0);
+    errno = 0;
+    return A68_FALSE;
+  }
+  announce_phase ("executable loader");
+  trailer.name[SMALL_BUFFER_SIZE - 1] = NULL_CHAR;
+  trailer.options[SMALL_BUFFER_SIZE - 1] = NULL_CHAR;
+// Unpack into a private directory, so copies can run side by side, also from
+// a directory that is not writable. a68_exit removes it.
+  tmp = getenv ("TMPDIR");
+  if (tmp == NO_TEXT || strlen (tmp) == 0) {
+    tmp = "/tmp";
+  }
+  ASSERT (snprintf (executable_dir, SNPRINTF_SIZE, "%s/a68g.XXXXXX", tmp) >= 0);
+  if (mkdtemp (executable_dir) == NO_TEXT) {
+    executable_dir[0] = NULL_CHAR;
+    ABEND (A68_TRUE, ERROR_ACTION, tmp);
+  }
+  base = strrchr (trailer.name, '/');
+  base = (base == NO_TEXT ? trailer.name : &base[1]);
+  ASSERT (snprintf (name, SNPRINTF_SIZE, "%s/%s", executable_dir, base) >= 0);
+  ASSERT (lseek (exe, end - (off_t) (trailer.source_size + trailer.plugin_size), SEEK_SET) >= 0);
+  ASSERT (snprintf (file, SNPRINTF_SIZE, "%s.a68", name) >= 0);
+  extract_file (exe, trailer.source_size, file);
+  ASSERT (snprintf (file, SNPRINTF_SIZE, "%s%s", name, PLUGIN_EXTENSION) >= 0);
+  extract_file (exe, trailer.plugin_size, file);
+  ASSERT (close (exe) == 0);
+// Run it as a script, with the options it was compiled with.
+  FILE_INITIAL_NAME (&A68_JOB) = new_string (name, NO_TEXT);
+  OPTION_COMPILE_CHECK (&A68_JOB) = A68_FALSE;
+  isolate_options (trailer.options, NO_LINE);
+  (void) set_options (OPTION_LIST (&A68_JOB), A68_FALSE);
+  OPTION_RUN_SCRIPT (&A68_JOB) = A68_TRUE;
+  OPTION_NO_WARNINGS (&A68_JOB) = A68_TRUE;
+  OPTION_COMPILE (&A68_JOB) = A68_FALSE;
+  return A68_TRUE;
+}
+
 //! @brief Rewrite source for shell script .
 
 void rewrite_script_source (void)
@@ -169,4 +387,94 @@ void rewrite_script_source (void)
   ASSERT (close (source) == 0);
 }
 
+// Compiled plugins are cached in ~/.a68g/plugins, under a name derived from
+// a hash of the generated C code, the C compiler command and the a68g build.
+// The generated code is a function of the flattened source and the options,
+// so an unchanged program with unchanged options finds its plugin there and
+// the C compiler and linker are not called.
+
+//! @brief Add a block of bytes to a FNV-1a hash.
+
+static void plugin_cache_hash (long long unt *h, char *z, size_t n)
+{
+  for (size_t k = 0; k < n; k++) {
+    (*h) ^= (long long unt) (unsigned char) z[k];
+    (*h) *= 0x100000001b3ULL;
+  }
+}
+
+//! @brief Compose the cache file name for the current plugin.
+
+static BOOL_T plugin_cache_name (char *cmd, char *name)
+{
+  long long unt h = 0xcbf29ce484222325ULL;
+  char buf[BUFFER_SIZE];
+  char *home = getenv ("HOME");
+  FILE_T obj;
+  ssize_t n;
+  int rc;
+  if (!OPTION_PLUGIN_CACHE (&A68_JOB) || home == NO_TEXT) {
+    return A68_FALSE;
+  }
+  ASSERT (snprintf (name, SNPRINTF_SIZE, "%s/%s", home, A68_DIR) >= 0);
+  rc = mkdir (name, (mode_t) (S_IRUSR | S_IWUSR | S_IXUSR));
+  if (rc != 0 && errno != EEXIST) {
+    return A68_FALSE;
+  }
+  bufcat (name, "/" A68_PLUGIN_CACHE_DIR, BUFFER_SIZE);
+  rc = mkdir (name, (mode_t) (S_IRUSR | S_IWUSR | S_IXUSR));
+  if (rc != 0 && errno != EEXIST) {
+    return A68_FALSE;
+  }
+// Key is build, compiler command and generated code.
+  plugin_cache_hash (&h, PACKAGE_STRING " " __DATE__ " " __TIME__, strlen (PACKAGE_STRING " " __DATE__ " " __TIME__));
+  plugin_cache_hash (&h, cmd, strlen (cmd));
+  obj = open (FILE_OBJECT_NAME (&A68_JOB), O_RDONLY);
+  if (obj == -1) {
+    return A68_FALSE;
+  }
+  while ((n = io_read (obj, buf, BUFFER_SIZE)) > 0) {
+    plugin_cache_hash (&h, buf, (size_t) n);
+  }
+  ASSERT (close (obj) == 0);
+  if (n < 0) {
+    return A68_FALSE;
+  }
+  ASSERT (snprintf (buf, SNPRINTF_SIZE, "/%016llx%s", h, PLUGIN_EXTENSION) >= 0);
+  bufcat (name, buf, BUFFER_SIZE);
+  return A68_TRUE;
+}
+
+//! @brief Fetch a cached plugin for the current program, if there is one.
+
+BOOL_T plugin_cache_fetch (char *cmd)
+{
+  BUFFER name;
+  BUFCLR (name);
+  errno = 0;
+  if (!plugin_cache_name (cmd, name) || access (name, R_OK) != 0) {
+    return A68_FALSE;
+  }
+  return copy_file (name, FILE_PLUGIN_NAME (&A68_JOB));
+}
+
+//! @brief Store the plugin for the current program in the cache.
+
+void plugin_cache_store (char *cmd)
+{
+  BUFFER name, temp;
+  BUFCLR (name);
+  BUFCLR (temp);
+  errno = 0;
+  if (!plugin_cache_name (cmd, name)) {
+    return;
+  }
+// Concurrent runs may store the same plugin, so write a private copy first.
+  ASSERT (snprintf (temp, SNPRINTF_SIZE, "%s.%d", name, (int) getpid ()) >= 0);
+  if (!copy_file (FILE_PLUGIN_NAME (&A68_JOB), temp) || rename (temp, name) != 0) {
+    (void) remove (temp);
+  }
+  errno = 0;
+}
+
 #endif
@@ -43,6 +43,10 @@
 // 
 //   REF MODE, [] MODE, PROC PARAMSETY MODE
 // 
+// Fields of primitive mode are selected from structures of any mode, also
+// through chains of selections such as "x OF pos OF body", since the field
+// offsets are known at compile time.
+// 
 // The code generator employs a few simple optimisations like constant folding
 // and common subexpression elimination when DEREFERENCING or SLICING is
 // performed; for instance
@@ -445,6 +449,39 @@ NODE_T *stems_from (NODE_T * p, int att)
   }
 }
 
+//! @brief Identifier that a chain of selections stems from.
+
+NODE_T *selection_root (NODE_T * p, ADDR_T * offset, char **path)
+{
+// In "x OF pos OF p" the fields are at summed offsets in the structure of "p",
+// and "x OF pos" identifies the field for common subexpression elimination.
+  NODE_T *field, *sec, *idf;
+  p = stems_from (p, SELECTION);
+  if (p == NO_NODE) {
+    return NO_NODE;
+  }
+  field = SUB (p);
+  sec = NEXT (field);
+  idf = stems_from (sec, IDENTIFIER);
+  (*offset) += OFFSET_OFF (field);
+  if (idf != NO_NODE) {
+    (*path) = NSYMBOL (SUB (field));
+    return idf;
+  } else if (stems_from (sec, SELECTION) != NO_NODE) {
+    char *sub_path;
+    BUFFER chain;
+    idf = selection_root (sec, offset, &sub_path);
+    if (idf != NO_NODE) {
+      BUFCLR (chain);
+      ASSERT (snprintf (chain, SNPRINTF_SIZE, "%s OF %s", NSYMBOL (SUB (field)), sub_path) >= 0);
+      (*path) = TEXT (add_token (&A68 (top_token), chain));
+    }
+    return idf;
+  } else {
+    return NO_NODE;
+  }
+}
+
 // Auxilliary routines for emitting C code.
 
 //! @brief Whether frame needs initialisation.
@@ -639,10 +676,10 @@ void get_stack (NODE_T * p, FILE_T out, char *dst, char *cast)
     if (LEVEL (GINFO (p)) == A68 (global_level)) {
       indentf (out, snprintf (A68 (edit_line), SNPRINTF_SIZE, "GET_GLOBAL (%s, %s, " A68_LU ");\n", dst, cast, OFFSET (TAX (p))));
     } else {
-      indentf (out, snprintf (A68 (edit_line), SNPRINTF_SIZE, "GET_FRAME (%s, %s, %d, " A68_LU ");\n", dst, cast, LEVEL (GINFO (p)), OFFSET (TAX (p))));
+      indentf (out, snprintf (A68 (edit_line), SNPRINTF_SIZE, "GET_FRAME (%s, %s, %d, " A68_LU ");\n", dst, cast, DEPTH (GINFO (p)), OFFSET (TAX (p))));
     }
   } else {
-    indentf (out, snprintf (A68 (edit_line), SNPRINTF_SIZE, "GET_FRAME (%s, %s, %d, " A68_LU ");\n", dst, cast, LEVEL (GINFO (p)), OFFSET (TAX (p))));
+    indentf (out, snprintf (A68 (edit_line), SNPRINTF_SIZE, "GET_FRAME (%s, %s, %d, " A68_LU ");\n", dst, cast, DEPTH (GINFO (p)), OFFSET (TAX (p))));
   }
 }
 
@@ -83,6 +83,9 @@ void add_a68_standenv (BOOL_T portable, int a, NODE_T * n, char *c, MOID_T * m,
   } else if (a == LABEL) {
     INSERT_TAG (&LABELS (A68_STANDENV), new_one);
   }
+  if (a == IDENTIFIER || a == OP_SYMBOL || a == PRIO_SYMBOL || a == INDICANT || a == LABEL) {
+    index_tag (new_one, a);
+  }
 #undef INSERT_TAG
 }
 
@@ -436,8 +439,18 @@ void stand_prelude (void)
   a68_idf (A68_EXT, "blocks", A68_MCACHE (proc_int), genie_block);
   a68_idf (A68_EXT, "garbage", A68_MCACHE (proc_int), genie_garbage_freed);
   a68_idf (A68_EXT, "garbagefreed", A68_MCACHE (proc_int), genie_garbage_freed);
+  a68_idf (A68_EXT, "garbagetenured", A68_MCACHE (proc_int), genie_garbage_tenured);
+  a68_idf (A68_EXT, "minorcollections", A68_MCACHE (proc_int), genie_minor_collections);
+  a68_idf (A68_EXT, "majorcollections", A68_MCACHE (proc_int), genie_major_collections);
+  a68_idf (A68_EXT, "minorgarbagefreed", A68_MCACHE (proc_int), genie_minor_garbage_freed);
   a68_idf (A68_EXT, "collectseconds", A68_MCACHE (proc_real), genie_garbage_seconds);
   a68_idf (A68_EXT, "garbageseconds", A68_MCACHE (proc_real), genie_garbage_seconds);
+  a68_idf (A68_EXT, "garbagesurvival", A68_MCACHE (proc_real), genie_garbage_survival);
+  a68_idf (A68_EXT, "garbagethreshold", A68_MCACHE (proc_real), genie_garbage_threshold);
+  a68_idf (A68_EXT, "allocationcollections", A68_MCACHE (proc_int), genie_allocation_collections);
+  a68_idf (A68_EXT, "allocationrate", A68_MCACHE (proc_real), genie_allocation_rate);
+  a68_idf (A68_EXT, "heapcapacity", A68_MCACHE (proc_int), genie_heap_capacity);
+  a68_idf (A68_EXT, "handlecapacity", A68_MCACHE (proc_int), genie_handle_capacity);
   a68_idf (A68_EXT, "stackpointer", M_INT, genie_stack_pointer);
   a68_idf (A68_EXT, "systemstackpointer", M_INT, genie_system_stack_pointer);
   a68_idf (A68_EXT, "systemstacksize", M_INT, genie_system_stack_size);
@@ -2540,6 +2553,8 @@ void stand_extensions (void)
 //
   m = a68_proc (M_INT, M_STRING, M_STRING, M_REF_STRING, NO_MOID);
   a68_idf (A68_EXT, "subinstring", m, genie_sub_in_string);
+  a68_idf (A68_EXT, "regexcachehits", A68_MCACHE (proc_int), genie_regex_cache_hits);
+  a68_idf (A68_EXT, "regexcachemisses", A68_MCACHE (proc_int), genie_regex_cache_misses);
 #if defined (HAVE_DIRENT_H)
   m = a68_proc (M_ROW_STRING, M_STRING, NO_MOID);
   a68_idf (A68_EXT, "getdirectory", m, genie_directory);
@@ -2701,6 +2716,40 @@ void stand_postgresql (void)
   m = a68_proc (M_INT, M_REF_FILE, M_INT, M_INT, NO_MOID);
   a68_idf (A68_EXT, "pqgetvalue", m, genie_pq_getvalue);
   a68_idf (A68_EXT, "pqgetisnull", m, genie_pq_getisnull);
+//
+  m = a68_proc (M_ROW_STRING, M_REF_FILE, M_INT, NO_MOID);
+  a68_idf (A68_EXT, "pqgetcolumn", m, genie_pq_getcolumn);
+  m = a68_proc (M_ROW_INT, M_REF_FILE, M_INT, NO_MOID);
+  a68_idf (A68_EXT, "pqgetintcolumn", m, genie_pq_getintcolumn);
+  m = a68_proc (M_ROW_REAL, M_REF_FILE, M_INT, NO_MOID);
+  a68_idf (A68_EXT, "pqgetrealcolumn", m, genie_pq_getrealcolumn);
+// [, ] STRING.
+  MOID_T *row_row_string = add_mode (&TOP_MOID (&A68_JOB), ROW_SYMBOL, 2, NO_NODE, M_STRING, NO_PACK);
+  HAS_ROWS (row_row_string) = A68_TRUE;
+  SLICE (row_row_string) = M_ROW_STRING;
+  m = add_mode (&TOP_MOID (&A68_JOB), ROW_SYMBOL, 2, NO_NODE, M_ROW_CHAR, NO_PACK);
+  HAS_ROWS (m) = A68_TRUE;
+  SLICE (m) = M_ROW_ROW_CHAR;
+  DEFLEXED (row_row_string) = m;
+  m = a68_proc (row_row_string, M_REF_FILE, NO_MOID);
+  a68_idf (A68_EXT, "pqgetresult", m, genie_pq_getresult);
+  m = a68_proc (M_INT, M_REF_FILE, NO_MOID);
+  a68_idf (A68_EXT, "pqgetrow", m, genie_pq_getrow);
+  a68_idf (A68_EXT, "pqsinglerowmode", m, genie_pq_singlerowmode);
+//
+  m = a68_proc (M_INT, M_REF_FILE, M_STRING, NO_MOID);
+  a68_idf (A68_EXT, "pqsendquery", m, genie_pq_sendquery);
+  m = a68_proc (M_INT, M_REF_FILE, NO_MOID);
+  a68_idf (A68_EXT, "pqnextresult", m, genie_pq_nextresult);
+  a68_idf (A68_EXT, "pqconsumeinput", m, genie_pq_consumeinput);
+  a68_idf (A68_EXT, "pqflush", m, genie_pq_flush);
+  a68_idf (A68_EXT, "pqenterpipelinemode", m, genie_pq_enterpipelinemode);
+  a68_idf (A68_EXT, "pqexitpipelinemode", m, genie_pq_exitpipelinemode);
+  a68_idf (A68_EXT, "pqpipelinesync", m, genie_pq_pipelinesync);
+  m = a68_proc (M_BOOL, M_REF_FILE, NO_MOID);
+  a68_idf (A68_EXT, "pqisbusy", m, genie_pq_isbusy);
+  m = a68_proc (M_INT, M_REF_FILE, M_BOOL, NO_MOID);
+  a68_idf (A68_EXT, "pqsetnonblocking", m, genie_pq_setnonblocking);
 }
 
 #endif
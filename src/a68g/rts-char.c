@@ -95,8 +95,131 @@ void n (NODE_T * p) {\
 }
 A68_CHAR_CHAR (genie_to_lower, TO_LOWER)
   A68_CHAR_CHAR (genie_to_upper, TO_UPPER)
+
+//! @brief First character of a [] CHAR that has elements, and the stride to the next one; return whether its block is packed.
+
+BOOL_T char_sweep (A68_ARRAY * arr, A68_TUPLE * tup, BYTE_T ** q, int *inc)
+{
+  A68_REF *z = &ARRAY (arr);
+  if (PACKED_ROW (z)) {
+    *q = PACKED_ADDRESS (z, VECTOR_OFFSET (arr, tup));
+    *inc = SPAN (tup) * ELEM_SIZE (arr) / SIZE_ALIGNED (A68_CHAR);
+    return A68_TRUE;
+  } else {
+    *q = &(ADDRESS (z)[VECTOR_OFFSET (arr, tup)]);
+    *inc = SPAN (tup) * ELEM_SIZE (arr);
+    return A68_FALSE;
+  }
+}
+
+//! @brief Whether the characters of a [] CHAR can go into a packed block.
+
+BOOL_T packable_chars (A68_ARRAY * arr, A68_TUPLE * tup)
+{
+  int len = ROW_SIZE (tup);
+  if (len == 0 || PACKED_ROW (&ARRAY (arr))) {
+    return A68_TRUE;
+  }
+  BYTE_T *q;
+  int inc;
+  (void) char_sweep (arr, tup, &q, &inc);
+  for (int k = 0; k < len; k++, q += inc) {
+    if (!PACKABLE_CHAR ((A68_CHAR *) q)) {
+      return A68_FALSE;
+    }
+  }
+  return A68_TRUE;
+}
+
+//! @brief Copy the characters of a [] CHAR to "dst", as bytes when "packed" or else as A68_CHARs, "inc" bytes apart.
+
+void copy_chars (BYTE_T * dst, BOOL_T packed, int inc, A68_ARRAY * arr, A68_TUPLE * tup)
+{
+  int len = ROW_SIZE (tup);
+  if (len == 0) {
+    return;
+  }
+  BYTE_T *src;
+  int step;
+  BOOL_T from = char_sweep (arr, tup, &src, &step);
+  if (from == packed && step == inc && inc == (packed ? 1 : SIZE (M_CHAR))) {
+// Contiguous characters are copied in one sweep.
+    (void) memmove (dst, src, (size_t) (len * inc));
+  } else if (packed) {
+    for (int k = 0; k < len; k++, src += step, dst += inc) {
+      *dst = (BYTE_T) CHAR_AT (from, src);
+    }
+  } else if (from) {
+    for (int k = 0; k < len; k++, src += step, dst += inc) {
+      STATUS ((A68_CHAR *) dst) = INIT_MASK;
+      VALUE ((A68_CHAR *) dst) = (int) *src;
+    }
+  } else {
+// Unpacked characters keep their status.
+    for (int k = 0; k < len; k++, src += step, dst += inc) {
+      COPY_ALIGNED (dst, src, SIZE (M_CHAR));
+    }
+  }
+}
+
+//! @brief Make a [] CHAR of "len" characters in a packed block, and point "q" at its first character.
+
+A68_REF packed_string (NODE_T * p, int len, BYTE_T ** q)
+{
+// Offsets remain those of A68_CHARs, so these must fit.
+  if ((REAL_T) len * (REAL_T) SIZE (M_CHAR) > (REAL_T) A68_MAX_INT) {
+    diagnostic (A68_RUNTIME_ERROR, p, ERROR_OUT_OF_CORE);
+    exit_genie (p, A68_RUNTIME_ERROR);
+  }
+  A68_REF z = heap_generator (p, M_ROW_CHAR, DESCRIPTOR_SIZE (1));
+  A68_REF row = heap_generator (p, M_ROW_CHAR, len);
+  STATUS_SET (REF_HANDLE (&row), PACKED_MASK);
+  A68_ARRAY arr; A68_TUPLE tup;
+  DIM (&arr) = 1;
+  MOID (&arr) = M_CHAR;
+  ELEM_SIZE (&arr) = SIZE (M_CHAR);
+  SLICE_OFFSET (&arr) = 0;
+  FIELD_OFFSET (&arr) = 0;
+  ARRAY (&arr) = row;
+  LWB (&tup) = 1;
+  UPB (&tup) = len;
+  SHIFT (&tup) = LWB (&tup);
+  SPAN (&tup) = 1;
+  K (&tup) = 0;
+  PUT_DESCRIPTOR (arr, tup, &z);
+  *q = ADDRESS (&row);
+  return z;
+}
+
+//! @brief Unpack the block of a [] CHAR that name "z" refers to, if it is packed.
+
+void unpack_row (NODE_T * p, A68_REF * z)
+{
+// The characters are copied to a new block of A68_CHARs, that then changes place
+// with the packed block, so all names that refer to either see A68_CHARs.
+  A68_HANDLE *x = REF_HANDLE (z);
+  if (!(IS_IN_HEAP (z) && STATUS_TEST (x, PACKED_MASK))) {
+    return;
+  }
+  if ((REAL_T) SIZE (x) * (REAL_T) SIZE (M_CHAR) > (REAL_T) A68_MAX_INT) {
+    diagnostic (A68_RUNTIME_ERROR, p, ERROR_OUT_OF_CORE);
+    exit_genie (p, A68_RUNTIME_ERROR);
+  }
+  A68_REF row = heap_generator (p, MOID (x), SIZE (x) * SIZE (M_CHAR));
+  A68_HANDLE *y = REF_HANDLE (&row);
+  BYTE_T *u = POINTER (x);
+  A68_CHAR *v = (A68_CHAR *) POINTER (y);
+  for (int k = 0; k < SIZE (x); k++, v++) {
+    STATUS (v) = INIT_MASK;
+    VALUE (v) = (int) u[k];
+  }
+  USED (y) = USED (x);
+  exchange_blocks (x, y);
+}
+
 //! @brief OP + = (CHAR, CHAR) STRING
-     void genie_add_char (NODE_T * p)
+
+void genie_add_char (NODE_T * p)
 {
   A68_CHAR a, b;
   A68_REF c, d;
@@ -110,6 +233,13 @@ A68_CHAR_CHAR (genie_to_lower, TO_LOWER)
   POP_OBJECT (p, &a, A68_CHAR);
   CHECK_INIT (p, INITIALISED (&a), M_CHAR);
 // sum.
+  if (PACKABLE_CHAR (&a) && PACKABLE_CHAR (&b)) {
+    c = packed_string (p, 2, &b_3);
+    b_3[0] = (BYTE_T) VALUE (&a);
+    b_3[1] = (BYTE_T) VALUE (&b);
+    PUSH_REF (p, c);
+    return;
+  }
   c = heap_generator (p, M_STRING, DESCRIPTOR_SIZE (1));
   d = heap_generator (p, M_STRING, 2 * SIZE (M_CHAR));
   GET_DESCRIPTOR (a_3, t_3, &c);
@@ -138,17 +268,17 @@ void genie_elem_string (NODE_T * p)
   A68_ARRAY *a;
   A68_TUPLE *t;
   A68_INT k;
-  BYTE_T *base;
-  A68_CHAR *ch;
   POP_REF (p, &z);
   CHECK_REF (p, z, M_STRING);
   POP_OBJECT (p, &k, A68_INT);
   GET_DESCRIPTOR (a, t, &z);
   PRELUDE_ERROR (VALUE (&k) < LWB (t), p, ERROR_INDEX_OUT_OF_BOUNDS, NO_TEXT);
   PRELUDE_ERROR (VALUE (&k) > UPB (t), p, ERROR_INDEX_OUT_OF_BOUNDS, NO_TEXT);
-  base = DEREF (BYTE_T, &(ARRAY (a)));
-  ch = (A68_CHAR *) & (base[INDEX_1_DIM (a, t, VALUE (&k))]);
-  PUSH_VALUE (p, VALUE (ch), A68_CHAR);
+  A68_REF name = ARRAY (a);
+  OFFSET (&name) += INDEX_1_DIM (a, t, VALUE (&k));
+  BOOL_T packed = PACKED_ROW (&name);
+  BYTE_T *q = (packed ? PACKED_ADDRESS (&name, 0) : ADDRESS (&name));
+  PUSH_VALUE (p, CHAR_AT (packed, q), A68_CHAR);
 }
 
 //! @brief OP + = (STRING, STRING) STRING
@@ -158,7 +288,6 @@ void genie_add_string (NODE_T * p)
   A68_REF a, b, c, d;
   A68_ARRAY *a_1, *a_2, *a_3;
   A68_TUPLE *t_1, *t_2, *t_3;
-  BYTE_T *b_1, *b_2, *b_3;
 // right part.
   POP_REF (p, &b);
   CHECK_INIT (p, INITIALISED (&b), M_STRING);
@@ -170,6 +299,16 @@ void genie_add_string (NODE_T * p)
   GET_DESCRIPTOR (a_1, t_1, &a);
   int l_1 = ROW_SIZE (t_1);
 // sum.
+  if (packable_chars (a_1, t_1) && packable_chars (a_2, t_2)) {
+    BYTE_T *b_3;
+    c = packed_string (p, l_1 + l_2, &b_3);
+    GET_DESCRIPTOR (a_1, t_1, &a);
+    GET_DESCRIPTOR (a_2, t_2, &b);
+    copy_chars (b_3, A68_TRUE, 1, a_1, t_1);
+    copy_chars (&b_3[l_1], A68_TRUE, 1, a_2, t_2);
+    PUSH_REF (p, c);
+    return;
+  }
   c = heap_generator (p, M_STRING, DESCRIPTOR_SIZE (1));
   d = heap_generator (p, M_STRING, (l_1 + l_2) * SIZE (M_CHAR));
 // Calculate again since garbage collector might have moved data.
@@ -187,22 +326,9 @@ void genie_add_string (NODE_T * p)
   SHIFT (t_3) = LWB (t_3);
   SPAN (t_3) = 1;
 // add strings.
-  b_3 = DEREF (BYTE_T, &ARRAY (a_3));
-  int m = 0;
-  if (ROW_SIZE (t_1) > 0) {
-    b_1 = DEREF (BYTE_T, &ARRAY (a_1));
-    for (int k = LWB (t_1); k <= UPB (t_1); k++) {
-      MOVE ((BYTE_T *) & b_3[m], (BYTE_T *) & b_1[INDEX_1_DIM (a_1, t_1, k)], SIZE (M_CHAR));
-      m += SIZE (M_CHAR);
-    }
-  }
-  if (ROW_SIZE (t_2) > 0) {
-    b_2 = DEREF (BYTE_T, &ARRAY (a_2));
-    for (int k = LWB (t_2); k <= UPB (t_2); k++) {
-      MOVE ((BYTE_T *) & b_3[m], (BYTE_T *) & b_2[INDEX_1_DIM (a_2, t_2, k)], SIZE (M_CHAR));
-      m += SIZE (M_CHAR);
-    }
-  }
+  BYTE_T *b_3 = DEREF (BYTE_T, &ARRAY (a_3));
+  copy_chars (b_3, A68_FALSE, SIZE (M_CHAR), a_1, t_1);
+  copy_chars (&b_3[l_1 * SIZE (M_CHAR)], A68_FALSE, SIZE (M_CHAR), a_2, t_2);
   PUSH_REF (p, c);
 }
 
@@ -216,11 +342,38 @@ void genie_times_int_string (NODE_T * p)
   POP_OBJECT (p, &k, A68_INT);
   PRELUDE_ERROR (VALUE (&k) < 0, p, ERROR_INVALID_ARGUMENT, M_INT);
   CHECK_INT_SHORTEN (p, VALUE (&k));
-  PUSH_REF (p, empty_string (p));
-  while (VALUE (&k)--) {
-    PUSH_REF (p, a);
-    genie_add_string (p);
+  int n = (int) VALUE (&k);
+  if (n == 0) {
+    PUSH_REF (p, empty_string (p));
+    return;
+  }
+  CHECK_INIT (p, INITIALISED (&a), M_STRING);
+  A68_ARRAY *arr; A68_TUPLE *tup;
+  GET_DESCRIPTOR (arr, tup, &a);
+  int len = ROW_SIZE (tup);
+  if ((REAL_T) len * (REAL_T) n * (REAL_T) SIZE (M_CHAR) > (REAL_T) A68_MAX_INT) {
+    diagnostic (A68_RUNTIME_ERROR, p, ERROR_OUT_OF_CORE);
+    exit_genie (p, A68_RUNTIME_ERROR);
   }
+// Copy the string once, then replicate the copy.
+  BOOL_T packed = packable_chars (arr, tup);
+  int inc = (packed ? 1 : SIZE (M_CHAR));
+  A68_REF z;
+  BYTE_T *base;
+  if (packed) {
+    z = packed_string (p, len * n, &base);
+  } else {
+    A68_REF row; A68_ARRAY arr_z; A68_TUPLE tup_z;
+    NEW_ROW_1D (z, row, arr_z, tup_z, M_ROW_CHAR, M_CHAR, len * n);
+    base = ADDRESS (&row);
+  }
+  GET_DESCRIPTOR (arr, tup, &a);
+  copy_chars (base, packed, inc, arr, tup);
+  int m = len * inc;
+  for (int j = 1; j < n; j++) {
+    (void) memcpy (&base[j * m], base, (size_t) m);
+  }
+  PUSH_REF (p, z);
 }
 
 //! @brief OP * = (STRING, INT) STRING
@@ -248,6 +401,13 @@ void genie_times_int_char (NODE_T * p)
   PRELUDE_ERROR (VALUE (&str_size) < 0, p, ERROR_INVALID_ARGUMENT, M_INT);
   CHECK_INT_SHORTEN (p, VALUE (&str_size));
 // Make new string.
+  if (PACKABLE_CHAR (&a)) {
+    BYTE_T *base;
+    A68_REF z = packed_string (p, (int) (VALUE (&str_size)), &base);
+    (void) memset (base, VALUE (&a), (size_t) VALUE (&str_size));
+    PUSH_REF (p, z);
+    return;
+  }
   A68_REF z, row; A68_ARRAY arr; A68_TUPLE tup;
   NEW_ROW_1D (z, row, arr, tup, M_ROW_CHAR, M_CHAR, (int) (VALUE (&str_size)));
   BYTE_T *base = ADDRESS (&row);
@@ -277,7 +437,88 @@ void genie_times_char_int (NODE_T * p)
 
 void genie_plusab_string (NODE_T * p)
 {
-  genie_f_and_becomes (p, M_REF_STRING, genie_add_string);
+// A body generated here has spare capacity, and its handle records the extent
+// in use. A destination that ends at that extent is appended to in place, so
+// building a string with +:= takes linear time. No other row can refer to the
+// elements beyond the extent in use, hence appending there is safe.
+// The extent is in A68_CHARs also when the body is packed.
+  A68_REF a, b, c;
+  A68_ARRAY *a_1, *a_2, *a_3;
+  A68_TUPLE *t_1, *t_2, *t_3;
+// right part.
+  POP_REF (p, &b);
+  CHECK_INIT (p, INITIALISED (&b), M_STRING);
+  GET_DESCRIPTOR (a_2, t_2, &b);
+  int l_2 = ROW_SIZE (t_2);
+// left part, the REF STRING stays on the stack as result.
+  A68_REF *dst = (A68_REF *) STACK_OFFSET (-A68_REF_SIZE);
+  CHECK_REF (p, *dst, M_REF_STRING);
+  a = *DEREF (A68_REF, dst);
+  CHECK_REF (p, a, M_STRING);
+  GET_DESCRIPTOR (a_1, t_1, &a);
+  int l_1 = ROW_SIZE (t_1);
+  A68_REF body = ARRAY (a_1);
+  if (l_1 > 0 && IS_IN_HEAP (&body) && SPAN (t_1) == 1 && ELEM_SIZE (a_1) == SIZE (M_CHAR) && FIELD_OFFSET (a_1) == 0) {
+    A68_HANDLE *h = REF_HANDLE (&body);
+    BOOL_T packed = STATUS_TEST (h, PACKED_MASK);
+    int start = OFFSET (&body) + VECTOR_OFFSET (a_1, t_1), end = start + l_1 * SIZE (M_CHAR);
+    int room = (packed ? SIZE (h) : SIZE (h) / SIZE (M_CHAR)) - end / SIZE (M_CHAR);
+    if (USED (h) == end && l_2 <= room && (!packed || packable_chars (a_2, t_2))) {
+      c = heap_generator (p, M_STRING, DESCRIPTOR_SIZE (1));
+      GET_DESCRIPTOR (a_1, t_1, &a);
+      GET_DESCRIPTOR (a_2, t_2, &b);
+      GET_DESCRIPTOR (a_3, t_3, &c);
+      DIM (a_3) = 1;
+      MOID (a_3) = M_CHAR;
+      ELEM_SIZE (a_3) = SIZE (M_CHAR);
+      SLICE_OFFSET (a_3) = VECTOR_OFFSET (a_1, t_1) / SIZE (M_CHAR);
+      FIELD_OFFSET (a_3) = 0;
+      ARRAY (a_3) = body;
+      LWB (t_3) = 1;
+      UPB (t_3) = l_1 + l_2;
+      SHIFT (t_3) = LWB (t_3);
+      SPAN (t_3) = 1;
+      if (packed) {
+        copy_chars (&(POINTER (h)[end / SIZE (M_CHAR)]), A68_TRUE, 1, a_2, t_2);
+      } else {
+        copy_chars (&(POINTER (h)[end]), A68_FALSE, SIZE (M_CHAR), a_2, t_2);
+      }
+      USED (h) = end + l_2 * SIZE (M_CHAR);
+      *DEREF (A68_REF, dst) = c;
+      return;
+    }
+  }
+// Generate a body with spare capacity.
+  int need = l_1 + l_2, cap = need + need / 2 + 8;
+  if ((REAL_T) cap * (REAL_T) SIZE (M_CHAR) > (REAL_T) A68_MAX_INT) {
+    cap = need;
+  }
+  BOOL_T packed = packable_chars (a_1, t_1) && packable_chars (a_2, t_2);
+  int inc = (packed ? 1 : SIZE (M_CHAR));
+  c = heap_generator (p, M_STRING, DESCRIPTOR_SIZE (1));
+  body = heap_generator (p, M_STRING, cap * inc);
+  if (packed) {
+    STATUS_SET (REF_HANDLE (&body), PACKED_MASK);
+  }
+// Calculate again since garbage collector might have moved data.
+  GET_DESCRIPTOR (a_1, t_1, &a);
+  GET_DESCRIPTOR (a_2, t_2, &b);
+  GET_DESCRIPTOR (a_3, t_3, &c);
+  DIM (a_3) = 1;
+  MOID (a_3) = M_CHAR;
+  ELEM_SIZE (a_3) = SIZE (M_CHAR);
+  SLICE_OFFSET (a_3) = 0;
+  FIELD_OFFSET (a_3) = 0;
+  ARRAY (a_3) = body;
+  LWB (t_3) = 1;
+  UPB (t_3) = need;
+  SHIFT (t_3) = LWB (t_3);
+  SPAN (t_3) = 1;
+  BYTE_T *b_3 = DEREF (BYTE_T, &body);
+  copy_chars (b_3, packed, inc, a_1, t_1);
+  copy_chars (&b_3[l_1 * inc], packed, inc, a_2, t_2);
+  USED (REF_HANDLE (&body)) = need * SIZE (M_CHAR);
+  *DEREF (A68_REF, dst) = c;
 }
 
 //! @brief OP +=: = (STRING, REF STRING) REF STRING
@@ -309,12 +550,9 @@ void genie_timesab_string (NODE_T * p)
   CHECK_REF (p, ref, M_REF_STRING);
   A68_REF a = *DEREF (A68_REF, &ref);
   CHECK_INIT (p, INITIALISED (&a), M_STRING);
-// Multiplication as repeated addition.
-  PUSH_REF (p, empty_string (p));
-  for (int i = 1; i <= VALUE (&k); i++) {
-    PUSH_REF (p, a);
-    genie_add_string (p);
-  }
+  PUSH_VALUE (p, VALUE (&k), A68_INT);
+  PUSH_REF (p, a);
+  genie_times_int_string (p);
 // The stack contains a STRING, promote to REF STRING.
   POP_REF (p, DEREF (A68_REF, &ref));
   PUSH_REF (p, ref);
@@ -338,21 +576,19 @@ int string_difference (NODE_T * p)
   int s_1 = ROW_SIZE (t_1);
 // Compute string difference.
   int size = (s_1 > s_2 ? s_1 : s_2), diff = 0;
-  BYTE_T *b_1 = (s_1 > 0 ? DEREF (BYTE_T, &ARRAY (a_1)) : NO_BYTE);
-  BYTE_T *b_2 = (s_2 > 0 ? DEREF (BYTE_T, &ARRAY (a_2)) : NO_BYTE);
+  BYTE_T *b_1 = NO_BYTE, *b_2 = NO_BYTE;
+  int inc_1 = 0, inc_2 = 0;
+  BOOL_T pk_1 = (s_1 > 0 && char_sweep (a_1, t_1, &b_1, &inc_1));
+  BOOL_T pk_2 = (s_2 > 0 && char_sweep (a_2, t_2, &b_2, &inc_2));
   for (int k = 0; k < size && diff == 0; k++) {
-    int a, b;
-    if (s_1 > 0 && k < s_1) {
-      A68_CHAR *ch = (A68_CHAR *) & b_1[INDEX_1_DIM (a_1, t_1, LWB (t_1) + k)];
-      a = (int) VALUE (ch);
-    } else {
-      a = 0;
+    int a = 0, b = 0;
+    if (k < s_1) {
+      a = CHAR_AT (pk_1, b_1);
+      b_1 += inc_1;
     }
-    if (s_2 > 0 && k < s_2) {
-      A68_CHAR *ch = (A68_CHAR *) & b_2[INDEX_1_DIM (a_2, t_2, LWB (t_2) + k)];
-      b = (int) VALUE (ch);
-    } else {
-      b = 0;
+    if (k < s_2) {
+      b = CHAR_AT (pk_2, b_2);
+      b_2 += inc_2;
     }
     diff += (TO_UCHAR (a) - TO_UCHAR (b));
   }
@@ -582,13 +818,15 @@ void genie_char_in_string (NODE_T * p)
   POP_REF (p, &ref_pos);
   A68_CHAR c;
   POP_OBJECT (p, &c, A68_CHAR);
-  reset_transput_buffer (PATTERN_BUFFER);
-  add_a_string_transput_buffer (p, PATTERN_BUFFER, (BYTE_T *) & ref_str);
-  int len = get_transput_buffer_index (PATTERN_BUFFER);
-  char *q = get_transput_buffer (PATTERN_BUFFER);
   char ch = (char) VALUE (&c);
-  for (int k = 0; k < len; k++) {
-    if (q[k] == ch) {
+  int len = ROW_SIZE (tup), inc = 0;
+  BYTE_T *q = NO_BYTE;
+  BOOL_T packed = (len > 0 && char_sweep (arr, tup, &q, &inc));
+  for (int k = 0; k < len; k++, q += inc) {
+    if (!packed) {
+      CHECK_INIT (p, INITIALISED ((A68_CHAR *) q), M_CHAR);
+    }
+    if ((char) CHAR_AT (packed, q) == ch) {
       STATUS (&pos) = INIT_MASK;
       VALUE (&pos) = k + LOWER_BOUND (tup);
       *DEREF (A68_INT, &ref_pos) = pos;
@@ -612,13 +850,18 @@ void genie_last_char_in_string (NODE_T * p)
   POP_REF (p, &ref_pos);
   A68_CHAR c;
   POP_OBJECT (p, &c, A68_CHAR);
-  reset_transput_buffer (PATTERN_BUFFER);
-  add_a_string_transput_buffer (p, PATTERN_BUFFER, (BYTE_T *) & ref_str);
-  int len = get_transput_buffer_index (PATTERN_BUFFER);
-  char *q = get_transput_buffer (PATTERN_BUFFER);
   char ch = (char) VALUE (&c);
-  for (int k = len - 1; k >= 0; k--) {
-    if (q[k] == ch) {
+  int len = ROW_SIZE (tup), inc = 0;
+  BYTE_T *q = NO_BYTE;
+  BOOL_T packed = (len > 0 && char_sweep (arr, tup, &q, &inc));
+  if (len > 0) {
+    q += (len - 1) * inc;
+  }
+  for (int k = len - 1; k >= 0; k--, q -= inc) {
+    if (!packed) {
+      CHECK_INIT (p, INITIALISED ((A68_CHAR *) q), M_CHAR);
+    }
+    if ((char) CHAR_AT (packed, q) == ch) {
       STATUS (&pos) = INIT_MASK;
       VALUE (&pos) = k + LOWER_BOUND (tup);
       *DEREF (A68_INT, &ref_pos) = pos;
@@ -148,6 +148,7 @@ int end_of_format (NODE_T * p, A68_REF ref_file)
     if (VALUE (&z) == A68_FALSE) {
 // Restart format.
       A68_FP = FRAME_POINTER (file);
+      SET_DISPLAY (-1);
       A68_SP = STACK_POINTER (file);
       open_format_frame (p, ref_file, &FORMAT (file), NOT_EMBEDDED_FORMAT, A68_TRUE);
     }
@@ -1213,10 +1214,17 @@ void write_real_pattern (NODE_T * p, MOID_T * mode, MOID_T * root, BYTE_T * item
         put_sign_to_integral (sign_mould, sign);
       }
       x = ABS (x);
+#if (A68_LEVEL >= 3)
+      if (expo_mould != NO_NODE) {
+        standardise_real (x, stag_digits, frac_digits, &exp_value);
+      }
+      str = sub_fixed_real (p, x, exp_value, mant_length, frac_digits);
+#else
       if (expo_mould != NO_NODE) {
         standardise (&x, stag_digits, frac_digits, &exp_value);
       }
       str = sub_fixed (p, x, mant_length, frac_digits);
+#endif
     } else if (mode == M_LONG_REAL || mode == M_LONG_INT) {
 #if (A68_LEVEL >= 3)
       DOUBLE_NUM_T x = VALUE ((A68_DOUBLE *) item);
@@ -1555,6 +1563,7 @@ void genie_write_standard_format (NODE_T * p, MOID_T * mode, BYTE_T * item, A68_
     }
     (*formats)++;
     A68_FP = FRAME_POINTER (file);
+    SET_DISPLAY (-1);
     A68_SP = STACK_POINTER (file);
     open_format_frame (p, ref_file, (A68_FORMAT *) item, NOT_EMBEDDED_FORMAT, A68_TRUE);
   } else if (mode == M_PROC_REF_FILE_VOID) {
@@ -1798,6 +1807,7 @@ void genie_write_standard_format (NODE_T * p, MOID_T * mode, BYTE_T * item, A68_
     A68_TUPLE *tup;
     CHECK_INIT (p, INITIALISED ((A68_REF *) item), M_ROWS);
     GET_DESCRIPTOR (arr, tup, (A68_REF *) item);
+    UNPACK_ROW (p, arr, tup, (A68_REF *) item);
     if (get_row_size (tup, DIM (arr)) > 0) {
       BYTE_T *base_addr = DEREF (BYTE_T, &ARRAY (arr));
       BOOL_T done = A68_FALSE;
@@ -1910,6 +1920,7 @@ void genie_write_file_format (NODE_T * p)
   write_purge_buffer (p, ref_file, FORMATTED_BUFFER);
 // Forget about active formats.
   A68_FP = FRAME_POINTER (file);
+  SET_DISPLAY (-1);
   A68_SP = STACK_POINTER (file);
   FRAME_POINTER (file) = pop_fp;
   STACK_POINTER (file) = pop_sp;
@@ -2370,6 +2381,7 @@ void genie_read_standard_format (NODE_T * p, MOID_T * mode, BYTE_T * item, A68_R
     }
     (*formats)++;
     A68_FP = FRAME_POINTER (file);
+    SET_DISPLAY (-1);
     A68_SP = STACK_POINTER (file);
     open_format_frame (p, ref_file, (A68_FORMAT *) item, NOT_EMBEDDED_FORMAT, A68_TRUE);
   } else if (mode == M_PROC_REF_FILE_VOID) {
@@ -2505,6 +2517,7 @@ void genie_read_standard_format (NODE_T * p, MOID_T * mode, BYTE_T * item, A68_R
     A68_TUPLE *tup;
     CHECK_INIT (p, INITIALISED ((A68_REF *) item), M_ROWS);
     GET_DESCRIPTOR (arr, tup, (A68_REF *) item);
+    UNPACK_ROW (p, arr, tup, (A68_REF *) item);
     if (get_row_size (tup, DIM (arr)) > 0) {
       BYTE_T *base_addr = DEREF (BYTE_T, &ARRAY (arr));
       BOOL_T done = A68_FALSE;
@@ -2614,6 +2627,7 @@ void genie_read_file_format (NODE_T * p)
   BODY (&FORMAT (file)) = NO_NODE;
 // Forget about active formats.
   A68_FP = FRAME_POINTER (file);
+  SET_DISPLAY (-1);
   A68_SP = STACK_POINTER (file);
   FRAME_POINTER (file) = pop_fp;
   STACK_POINTER (file) = pop_sp;
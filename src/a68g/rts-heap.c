@@ -46,6 +46,25 @@
 // 
 // Mark-and-collect is simple but since it walks recursive structures, it could
 // exhaust the C-stack (segment violation). A rough check is in place.
+//
+// The heap has two generations. Blocks that survive a collection are tenured:
+// they form the old generation at the bottom of the heap, up to the old heap
+// pointer, and are not moved by a minor collection. Blocks allocated since are
+// young. A pre-emptive collection is minor; it colours from the frames but stops
+// at old blocks, and it finds young blocks referred to from old ones by scanning
+// the old generation for handle addresses. Such a scan is conservative, but it
+// catches every store into an old block, also those made by the run-time library
+// that bypass assignations. Only young blocks are then freed and joined. When the 
+// heap remains crowded after a minor collection, a major collection follows, 
+// which colours and joins the whole heap as before. Calling "gc heap" always
+// triggers a major collection.
+//
+// The heap is made of segments. The first one is carved from the core block at
+// start up, further ones are mapped when the heap fills up, each as large as the
+// heap so far, up to the heap limit. Heap offsets run on from one segment into
+// the next, and a block never straddles two segments. The handle pool grows in
+// the same way. Since blocks are reached through their handle, a collection can
+// move them between segments, and segments that become empty are unmapped.
 // 
 // For dynamically sized objects, first bounds are evaluated (right first, then down).
 // The object is generated keeping track of the bound-count.
@@ -101,7 +120,7 @@ void genie_gc_heap (NODE_T * p)
 void genie_preemptive_gc_heap (NODE_T * p)
 {
   if (A68_GC (preemptive)) {
-    gc_heap ((NODE_T *) (p), A68_FP);
+    gc_heap_minor ((NODE_T *) (p), A68_FP);
   }
 }
 
@@ -133,6 +152,41 @@ void genie_garbage_freed (NODE_T * p)
   PUSH_VALUE (p, A68_GC (total), A68_INT);
 }
 
+//! @brief INT minor collections
+
+void genie_minor_collections (NODE_T * p)
+{
+  PUSH_VALUE (p, A68_GC (minor_sweeps), A68_INT);
+}
+
+//! @brief INT major collections
+
+void genie_major_collections (NODE_T * p)
+{
+  PUSH_VALUE (p, A68_GC (sweeps) - A68_GC (minor_sweeps) - A68_GC (allocation_sweeps), A68_INT);
+}
+
+//! @brief INT allocation collections
+
+void genie_allocation_collections (NODE_T * p)
+{
+  PUSH_VALUE (p, A68_GC (allocation_sweeps), A68_INT);
+}
+
+//! @brief INT minor garbage freed
+
+void genie_minor_garbage_freed (NODE_T * p)
+{
+  PUSH_VALUE (p, A68_GC (minor_total), A68_INT);
+}
+
+//! @brief INT garbage tenured
+
+void genie_garbage_tenured (NODE_T * p)
+{
+  PUSH_VALUE (p, A68_GC (old_heap_pointer) - A68 (fixed_heap_pointer), A68_INT);
+}
+
 //! @brief REAL garbage seconds
 
 void genie_garbage_seconds (NODE_T * p)
@@ -141,11 +195,71 @@ void genie_garbage_seconds (NODE_T * p)
   PUSH_VALUE (p, A68_GC (seconds), A68_REAL);
 }
 
+//! @brief REAL garbage survival
+
+void genie_garbage_survival (NODE_T * p)
+{
+  PUSH_VALUE (p, A68_GC (survival), A68_REAL);
+}
+
+//! @brief REAL garbage threshold
+
+void genie_garbage_threshold (NODE_T * p)
+{
+  PUSH_VALUE (p, A68_GC (threshold), A68_REAL);
+}
+
+//! @brief REAL allocation rate
+
+void genie_allocation_rate (NODE_T * p)
+{
+  PUSH_VALUE (p, A68_GC (rate), A68_REAL);
+}
+
+//! @brief INT heap capacity
+
+void genie_heap_capacity (NODE_T * p)
+{
+  PUSH_VALUE (p, A68_GC (heap_capacity), A68_INT);
+}
+
+//! @brief INT handle capacity
+
+void genie_handle_capacity (NODE_T * p)
+{
+  PUSH_VALUE (p, A68_GC (max_handles), A68_INT);
+}
+
 //! @brief Size available for an object in the heap.
 
-unt heap_available (void)
+ADDR_T heap_available (void)
 {
-  return A68 (heap_size) - A68_HP;
+  return A68_GC (heap_capacity) - A68_HP;
+}
+
+//! @brief Release mapped segments.
+
+static void unmap_segments (HEAP_SEGMENT_T * s, int n, size_t unit)
+{
+  int k;
+  for (k = 0; k < n; k++) {
+    if (MAPPED (&s[k])) {
+#if defined (HAVE_SYS_MMAN_H)
+      ASSERT (munmap (START (&s[k]), (size_t) SIZE (&s[k]) * unit) == 0);
+#endif
+      MAPPED (&s[k]) = A68_FALSE;
+    }
+  }
+}
+
+//! @brief Release the segments mapped when heap or handle pool grew.
+
+static void unmap_heap_segments (void)
+{
+  unmap_segments (A68_GC (heap_segments), A68_GC (heap_segment_count), 1);
+  unmap_segments (A68_GC (handle_segments), A68_GC (handle_segment_count), sizeof (A68_HANDLE));
+  A68_GC (heap_segment_count) = 0;
+  A68_GC (handle_segment_count) = 0;
 }
 
 //! @brief Initialise heap management.
@@ -165,24 +279,51 @@ void genie_init_heap (NODE_T * p)
   A68_GC (total) = 0;
   A68_GC (sweeps) = 0;
   A68_GC (refused) = 0;
+  A68_GC (minor_sweeps) = 0;
+  A68_GC (minor_total) = 0;
   A68_GC (preemptive) = A68_FALSE;
+  A68_GC (allocation_sweeps) = 0;
+  A68_GC (allocated) = 0;
+  A68_GC (rate) = 0;
+  A68_GC (survival) = 0;
+  A68_GC (last_seconds) = 0;
+  A68_GC (mutator_start) = seconds ();
+  A68_GC (threshold) = DEFAULT_PREEMPTIVE;
+  A68_GC (pins) = NO_VAR;
+  A68_GC (pin_count) = 0;
+  A68_GC (marks) = NO_VAR;
+  A68_GC (mark_count) = 0;
+  A68_GC (max_marks) = 0;
   ABEND (A68 (fixed_heap_pointer) >= (A68 (heap_size) - MIN_MEM_SIZE), ERROR_OUT_OF_CORE, __func__);
   A68_HP = A68 (fixed_heap_pointer);
+  A68_GC (old_heap_pointer) = A68_HP;
   A68 (heap_is_fluid) = A68_FALSE;
+  default_heap_limit ();
+// The first heap segment is the heap in the core block.
+  unmap_heap_segments ();
+  HEAP_SEGMENT_T *s = &(A68_GC (heap_segments)[0]);
+  MAPPED (s) = A68_FALSE;
+  START (s) = A68_HEAP;
+  BASE (s) = 0;
+  SIZE (s) = A68_ALIGN (A68 (heap_size));
+  A68_GC (heap_segment_count) = 1;
+  A68_GC (heap_capacity) = SIZE (s);
 // Assign handle space.
-  A68_HANDLE *z = (A68_HANDLE *) A68_HANDLES;
-  A68_GC (available_handles) = z;
-  A68_GC (busy_handles) = NO_HANDLE;
+// Handles that were never used are not linked, but handed out in order by
+// give_handle. Linking the whole pool here would touch every page of it,
+// which dominated startup of short programs.
   int N = (unt) A68 (handle_pool_size) / SIZE_ALIGNED (A68_HANDLE);
+  A68_GC (available_handles) = NO_HANDLE;
+  A68_GC (busy_handles) = NO_HANDLE;
   A68_GC (free_handles) = N;
   A68_GC (max_handles) = N;
-  for (int k = 0; k < N; k++) {
-    STATUS (&(z[k])) = NULL_MASK;
-    POINTER (&(z[k])) = NO_BYTE;
-    SIZE (&(z[k])) = 0;
-    NEXT (&z[k]) = (k == N - 1 ? NO_HANDLE : &z[k + 1]);
-    PREVIOUS (&z[k]) = (k == 0 ? NO_HANDLE : &z[k - 1]);
-  }
+  A68_GC (fresh_handles) = 0;
+  s = &(A68_GC (handle_segments)[0]);
+  MAPPED (s) = A68_FALSE;
+  START (s) = A68_HANDLES;
+  BASE (s) = 0;
+  SIZE (s) = N;
+  A68_GC (handle_segment_count) = 1;
 }
 
 //! @brief Whether mode must be coloured.
@@ -208,6 +349,8 @@ BOOL_T moid_needs_colouring (MOID_T * m)
   }
 }
 
+static void colour_value (BYTE_T *, MOID_T *);
+
 //! @brief Colour all elements of a row.
 
 void colour_row_elements (A68_REF * z, MOID_T * m)
@@ -218,7 +361,7 @@ void colour_row_elements (A68_REF * z, MOID_T * m)
   if (get_row_size (tup, DIM (arr)) == 0) {
 // Empty rows have a ghost elements.
     BYTE_T *elem = ADDRESS (&ARRAY (arr));
-    colour_object (&elem[0], SUB (m));
+    colour_value (&elem[0], SUB (m));
   } else {
 // The multi-dimensional garbage collector.
     BYTE_T *elem = ADDRESS (&ARRAY (arr));
@@ -227,72 +370,80 @@ void colour_row_elements (A68_REF * z, MOID_T * m)
     while (!done) {
       ADDR_T iindex = calculate_internal_index (tup, DIM (arr));
       ADDR_T addr = ROW_ELEMENT (arr, iindex);
-      colour_object (&elem[addr], SUB (m));
+      colour_value (&elem[addr], SUB (m));
       done = increment_internal_index (tup, DIM (arr));
     }
   }
 }
 
-//! @brief Colour an (active) object.
+//! @brief Push an object, or a block "h" whose mode is not known, that must still be coloured on the mark stack.
 
-void colour_object (BYTE_T * item, MOID_T * m)
+static void push_mark (BYTE_T * item, MOID_T * m, A68_HANDLE * h)
 {
-  if (item == NO_BYTE || m == NO_MOID) {
-    return;
+  if (A68_GC (mark_count) == A68_GC (max_marks)) {
+    int n = MAX (2 * A68_GC (max_marks), MARK_STACK_SIZE);
+    MARK_T *w = (MARK_T *) a68_alloc ((size_t) n * sizeof (MARK_T), __func__, __LINE__);
+    if (A68_GC (mark_count) > 0) {
+      (void) memcpy (w, A68_GC (marks), (size_t) A68_GC (mark_count) * sizeof (MARK_T));
+    }
+    a68_free (A68_GC (marks));
+    A68_GC (marks) = w;
+    A68_GC (max_marks) = n;
   }
-  if (!moid_needs_colouring (m)) {
+  MARK_T *k = &(A68_GC (marks)[A68_GC (mark_count)++]);
+  POINTER (k) = item;
+  MOID (k) = m;
+  HANDLE (k) = h;
+}
+
+//! @brief Colour an (active) object, but push objects it refers to on the mark stack.
+
+static void colour_value (BYTE_T * item, MOID_T * m)
+{
+// Recursion follows the mode here, so its depth does not depend on the data.
+  LOW_STACK_ALERT (NO_NODE);
+  if (item == NO_BYTE || m == NO_MOID || !moid_needs_colouring (m)) {
     return;
   }
-// Deeply recursive objects might exhaust the stack.
-  LOW_STACK_ALERT (NO_NODE);
   if (IS_REF (m)) {
 // REF AMODE colour pointer and object to which it refers.
     A68_REF *z = (A68_REF *) item;
-    if (INITIALISED (z) && IS_IN_HEAP (z)) {
-      if (STATUS_TEST (REF_HANDLE (z), COOKIE_MASK)) {
-        return;
-      }
+    if (INITIALISED (z) && IS_IN_HEAP (z) && !(STATUS_TEST (REF_HANDLE (z), COOKIE_MASK))) {
       STATUS_SET (REF_HANDLE (z), (COOKIE_MASK | COLOUR_MASK));
       if (!IS_NIL (*z)) {
-        colour_object (ADDRESS (z), SUB (m));
+        push_mark (ADDRESS (z), SUB (m), NO_HANDLE);
       }
-//    STATUS_CLEAR (REF_HANDLE (z), COOKIE_MASK);.
     }
   } else if (IF_ROW (m)) {
 // Claim the descriptor and the row itself.
     A68_REF *z = (A68_REF *) item;
-    if (INITIALISED (z) && IS_IN_HEAP (z)) {
+    if (INITIALISED (z) && IS_IN_HEAP (z) && !(STATUS_TEST (REF_HANDLE (z), COOKIE_MASK))) {
       A68_ARRAY *arr;
       A68_TUPLE *tup;
-      if (STATUS_TEST (REF_HANDLE (z), COOKIE_MASK)) {
-        return;
-      }
 // An array is ALWAYS in the heap.
       STATUS_SET (REF_HANDLE (z), (COOKIE_MASK | COLOUR_MASK));
       GET_DESCRIPTOR (arr, tup, z);
       if (REF_HANDLE (&(ARRAY (arr))) != NO_HANDLE) {
 // Assume its initialisation.
         MOID_T *n = DEFLEX (m);
-        STATUS_SET (REF_HANDLE (&(ARRAY (arr))), COLOUR_MASK);
+        STATUS_SET (REF_HANDLE (&(ARRAY (arr))), (COOKIE_MASK | COLOUR_MASK));
         if (moid_needs_colouring (SUB (n))) {
           colour_row_elements (z, n);
         }
       }
-//    STATUS_CLEAR (REF_HANDLE (z), COOKIE_MASK);.
       (void) tup;
     }
   } else if (IS_STRUCT (m)) {
 // STRUCTures - colour fields.
     PACK_T *p = PACK (m);
     for (; p != NO_PACK; FORWARD (p)) {
-      colour_object (&item[OFFSET (p)], MOID (p));
+      colour_value (&item[OFFSET (p)], MOID (p));
     }
   } else if (IS_UNION (m)) {
 // UNIONs - a united object may contain a value that needs colouring.
     A68_UNION *z = (A68_UNION *) item;
     if (INITIALISED (z)) {
-      MOID_T *united_moid = (MOID_T *) VALUE (z);
-      colour_object (&item[A68_UNION_SIZE], united_moid);
+      colour_value (&item[A68_UNION_SIZE], (MOID_T *) VALUE (z));
     }
   } else if (IS (m, PROC_SYMBOL)) {
 // PROCs - save a locale and the objects it points to.
@@ -303,11 +454,10 @@ void colour_object (BYTE_T * item, MOID_T * m)
       STATUS_SET (LOCALE (z), (COOKIE_MASK | COLOUR_MASK));
       for (; s != NO_PACK; FORWARD (s)) {
         if (VALUE ((A68_BOOL *) & u[0]) == A68_TRUE) {
-          colour_object (&u[SIZE (M_BOOL)], MOID (s));
+          push_mark (&u[SIZE (M_BOOL)], MOID (s), NO_HANDLE);
         }
         u = &(u[SIZE (M_BOOL) + SIZE (MOID (s))]);
       }
-//    STATUS_CLEAR (LOCALE (z), COOKIE_MASK);.
     }
   } else if (m == M_SOUND) {
 // Claim the data of a SOUND object, that is in the heap.
@@ -318,6 +468,34 @@ void colour_object (BYTE_T * item, MOID_T * m)
   }
 }
 
+static void scan_words (BYTE_T *, ADDR_T);
+
+//! @brief Colour what was pushed on the mark stack above "base".
+
+static void drain_marks (int base)
+{
+  while (A68_GC (mark_count) > base) {
+    MARK_T *k = &(A68_GC (marks)[--A68_GC (mark_count)]);
+    A68_HANDLE *z = HANDLE (k);
+    if (z != NO_HANDLE) {
+      scan_words (POINTER (z), (ADDR_T) SIZE (z));
+    } else {
+      colour_value (POINTER (k), MOID (k));
+    }
+  }
+}
+
+//! @brief Colour an (active) object.
+
+void colour_object (BYTE_T * item, MOID_T * m)
+{
+// Objects that REFs and PROC locales lead to are kept on a mark stack rather than
+// followed by recursion, so that long lists or chains of locales do not exhaust the stack.
+  int base = A68_GC (mark_count);
+  colour_value (item, m);
+  drain_marks (base);
+}
+
 //! @brief Colour active objects in the heap.
 
 void colour_heap (ADDR_T fp)
@@ -340,6 +518,360 @@ void colour_heap (ADDR_T fp)
   }
 }
 
+//! @brief Whether an address is that of a handle.
+
+static BOOL_T is_handle_address (BYTE_T * w)
+{
+  int k;
+  for (k = 0; k < A68_GC (handle_segment_count); k++) {
+    HEAP_SEGMENT_T *s = &(A68_GC (handle_segments)[k]);
+    BYTE_T *lwb = START (s), *upb = (BYTE_T *) & (((A68_HANDLE *) START (s))[SIZE (s)]);
+    if (w >= lwb && w < upb) {
+      return (BOOL_T) ((w - lwb) % sizeof (A68_HANDLE) == 0);
+    }
+  }
+  return A68_FALSE;
+}
+
+//! @brief Colour uncoloured blocks whose handle address appears in a stretch of memory, and push them on the mark stack.
+
+static void scan_words (BYTE_T * u, ADDR_T size)
+{
+// Modes are not known here, so any aligned word that holds a handle address counts.
+// Coloured handles carry a cookie, for instance old ones in a minor collection.
+  ADDR_T k;
+  for (k = 0; k + sizeof (BYTE_T *) <= size; k += sizeof (BYTE_T *)) {
+    A68_HANDLE *z = *(A68_HANDLE **) & u[k];
+    if (is_handle_address ((BYTE_T *) z) && STATUS_TEST (z, ALLOCATED_MASK) && !(STATUS_TEST (z, COOKIE_MASK))) {
+      STATUS_SET (z, (COOKIE_MASK | COLOUR_MASK));
+      push_mark (NO_BYTE, NO_MOID, z);
+    }
+  }
+}
+
+//! @brief Colour uncoloured blocks whose handle address appears in a stretch of memory.
+
+static void colour_words (BYTE_T * u, ADDR_T size)
+{
+// Blocks found are scanned in turn from the mark stack, so long lists do not exhaust the stack.
+  int base = A68_GC (mark_count);
+  scan_words (u, size);
+  drain_marks (base);
+}
+
+//! @brief Colour young blocks whose handle address appears in the old generation.
+
+static void colour_old_generation (void)
+{
+  int k;
+  for (k = 0; k < A68_GC (heap_segment_count); k++) {
+    HEAP_SEGMENT_T *s = &(A68_GC (heap_segments)[k]);
+    ADDR_T lwb = MAX (BASE (s), A68 (fixed_heap_pointer));
+    ADDR_T upb = MIN (BASE (s) + SIZE (s), A68_GC (old_heap_pointer));
+    if (lwb < upb) {
+      colour_words (&(START (s)[lwb - BASE (s)]), upb - lwb);
+    }
+  }
+// Pinned blocks may lie above the old generation.
+  for (k = 0; k < A68_GC (pin_count); k++) {
+    A68_HANDLE *z = A68_GC (pins)[k];
+    colour_words (POINTER (z), (ADDR_T) SIZE (z));
+  }
+}
+
+//! @brief Map a further heap segment of preferably "len", but at least "size" bytes.
+
+static BOOL_T grow_heap (ADDR_T size, ADDR_T len)
+{
+#if defined (HAVE_SYS_MMAN_H)
+// A segment cannot take the heap over its limit.
+  ADDR_T cap = A68_GC (heap_capacity);
+  len = A68_ALIGN (MAX (size, len));
+  if (A68_GC (heap_segment_count) >= MAX_HEAP_SEGMENTS || A68 (heap_limit) <= cap) {
+    return A68_FALSE;
+  }
+  if (len > A68 (heap_limit) - cap) {
+    len = A68 (heap_limit) - cap;
+    len -= len % A68_ALIGNMENT;
+  }
+  if (len == 0 || len < size) {
+    return A68_FALSE;
+  }
+  void *z = mmap (NULL, (size_t) len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (z == MAP_FAILED) {
+    errno = 0;
+    return A68_FALSE;
+  }
+  HEAP_SEGMENT_T *s = &(A68_GC (heap_segments)[A68_GC (heap_segment_count)++]);
+  MAPPED (s) = A68_TRUE;
+  START (s) = (BYTE_T *) z;
+  BASE (s) = cap;
+  SIZE (s) = len;
+  A68_GC (heap_capacity) += len;
+  return A68_TRUE;
+#else
+  (void) size;
+  (void) len;
+  return A68_FALSE;
+#endif
+}
+
+//! @brief Unmap trailing heap segments that a collection emptied.
+
+static void shrink_heap (void)
+{
+#if defined (HAVE_SYS_MMAN_H)
+// Keep segments while the rest of the heap would soon be crowded again,
+// or while blocks are pinned.
+  while (A68_GC (heap_segment_count) > 1 && A68_GC (pin_count) == 0) {
+    HEAP_SEGMENT_T *s = &(A68_GC (heap_segments)[A68_GC (heap_segment_count) - 1]);
+    ADDR_T rest = A68_GC (heap_capacity) - SIZE (s);
+    if (A68_HP > BASE (s) || (REAL_T) A68_HP / (REAL_T) rest > DEFAULT_PREEMPTIVE / 2) {
+      return;
+    }
+    ASSERT (munmap (START (s), (size_t) SIZE (s)) == 0);
+    MAPPED (s) = A68_FALSE;
+    A68_GC (heap_capacity) = rest;
+    A68_GC (heap_segment_count)--;
+  }
+#endif
+}
+
+//! @brief Map a further handle segment, doubling the handle pool.
+
+static BOOL_T grow_handles (void)
+{
+#if defined (HAVE_SYS_MMAN_H)
+// The handle pool takes no more room than the heap may.
+  UNSIGNED_T n = A68_GC (max_handles);
+  size_t len = (size_t) n * sizeof (A68_HANDLE);
+  if (A68_GC (handle_segment_count) >= MAX_HEAP_SEGMENTS || 2 * len > A68 (heap_limit)) {
+    return A68_FALSE;
+  }
+  void *z = mmap (NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (z == MAP_FAILED) {
+    errno = 0;
+    return A68_FALSE;
+  }
+  HEAP_SEGMENT_T *s = &(A68_GC (handle_segments)[A68_GC (handle_segment_count)++]);
+  MAPPED (s) = A68_TRUE;
+  START (s) = (BYTE_T *) z;
+  BASE (s) = n;
+  SIZE (s) = n;
+  A68_GC (max_handles) += n;
+  A68_GC (free_handles) += n;
+  return A68_TRUE;
+#else
+  return A68_FALSE;
+#endif
+}
+
+//! @brief Heap offset of an address in a heap segment.
+
+static ADDR_T heap_offset (BYTE_T * u)
+{
+// An empty block may sit at the end of a segment.
+  int k;
+  for (k = 0; k < A68_GC (heap_segment_count); k++) {
+    HEAP_SEGMENT_T *s = &(A68_GC (heap_segments)[k]);
+    if (u >= START (s) && u <= &(START (s)[SIZE (s)])) {
+      return BASE (s) + (ADDR_T) (u - START (s));
+    }
+  }
+  ABEND (A68_TRUE, ERROR_INTERNAL_CONSISTENCY, __func__);
+  return 0;
+}
+
+//! @brief Whether a block of "size" bytes at the heap pointer would overlap a pinned block.
+
+static BOOL_T overlaps_pin (ADDR_T size, ADDR_T * lwb, ADDR_T * upb)
+{
+// Pins are in order of offset.
+  int k;
+  for (k = 0; k < A68_GC (pin_count); k++) {
+    A68_HANDLE *z = A68_GC (pins)[k];
+    *lwb = heap_offset (POINTER (z));
+    *upb = *lwb + (ADDR_T) SIZE (z);
+    if (*upb > A68_HP) {
+      return (BOOL_T) (*lwb < A68_HP + size);
+    }
+  }
+  return A68_FALSE;
+}
+
+//! @brief Address for a block of "size" bytes at the heap pointer, NO_BYTE if there is no room.
+
+static BYTE_T *heap_room (ADDR_T size, ADDR_T grow)
+{
+// When there is no room, a segment of "grow" bytes is mapped if that is not 0.
+// A block that would overlap a pinned block goes after it, and a block that
+// does not fit in a segment goes into the next one, but only past the pinned
+// blocks in the rest of the segment. Room that is skipped is cleared, as a
+// minor collection scans the old generation.
+  int k = A68_GC (heap_segment_count) - 1;
+  while (k > 0 && A68_HP < BASE (&(A68_GC (heap_segments)[k]))) {
+    k--;
+  }
+  while (A68_TRUE) {
+    HEAP_SEGMENT_T *s = &(A68_GC (heap_segments)[k]);
+    ADDR_T end = BASE (s) + SIZE (s), lwb, upb;
+    if (A68_GC (pin_count) > 0 && overlaps_pin (size, &lwb, &upb) && lwb < end) {
+      (void) memset (&(START (s)[A68_HP - BASE (s)]), 0, (size_t) (lwb - A68_HP));
+      A68_HP = upb;
+    } else if (A68_HP + size <= end) {
+      return &(START (s)[A68_HP - BASE (s)]);
+    } else if (k + 1 < A68_GC (heap_segment_count)) {
+      (void) memset (&(START (s)[A68_HP - BASE (s)]), 0, (size_t) (end - A68_HP));
+      A68_HP = end;
+      k++;
+    } else if (grow == 0 || !grow_heap (size, grow)) {
+      return NO_BYTE;
+    }
+  }
+}
+
+//! @brief Clear the heap from the heap pointer up to offset "upb", and move the heap pointer there.
+
+static void clear_room (ADDR_T upb)
+{
+  int k = A68_GC (heap_segment_count) - 1;
+  while (k > 0 && A68_HP < BASE (&(A68_GC (heap_segments)[k]))) {
+    k--;
+  }
+  while (A68_HP < upb) {
+    HEAP_SEGMENT_T *s = &(A68_GC (heap_segments)[k++]);
+    ADDR_T end = MIN (upb, BASE (s) + SIZE (s));
+    (void) memset (&(START (s)[A68_HP - BASE (s)]), 0, (size_t) (end - A68_HP));
+    A68_HP = end;
+  }
+}
+
+//! @brief Slide the block of a handle down to the heap pointer, and advance the latter.
+
+static void slide_block (A68_HANDLE * z)
+{
+// Blocks come in order of offset. A block is never placed above its source,
+// as that would overwrite blocks that did not move yet. When the room below
+// its source is taken by a pinned block, it stays where it is.
+  BYTE_T *dst;
+  if (POINTER (z) == NO_BYTE || SIZE (z) == 0) {
+    dst = heap_room (0, 0);
+  } else {
+    ADDR_T src = heap_offset (POINTER (z));
+    ABEND (src < A68_HP, ERROR_INTERNAL_CONSISTENCY, __func__);
+    dst = heap_room ((ADDR_T) SIZE (z), 0);
+    if (dst == NO_BYTE || heap_offset (dst) > src) {
+      clear_room (src);
+      dst = POINTER (z);
+    } else if (dst != POINTER (z)) {
+      MOVE (dst, POINTER (z), (unt) SIZE (z));
+    }
+  }
+  ABEND (dst == NO_BYTE, ERROR_INTERNAL_CONSISTENCY, __func__);
+  POINTER (z) = dst;
+  A68_HP = heap_offset (dst) + (ADDR_T) SIZE (z);
+  ABEND (A68_HP % A68_ALIGNMENT != 0, ERROR_ALIGNMENT, __func__);
+}
+
+//! @brief Return a handle to the pool of available handles.
+
+static A68_HANDLE *release_handle (A68_HANDLE * z)
+{
+  A68_HANDLE *y = NEXT (z);
+  if (PREVIOUS (z) == NO_HANDLE) {
+    A68_GC (busy_handles) = NEXT (z);
+  } else {
+    NEXT (PREVIOUS (z)) = NEXT (z);
+  }
+  if (NEXT (z) != NO_HANDLE) {
+    PREVIOUS (NEXT (z)) = PREVIOUS (z);
+  }
+  NEXT (z) = A68_GC (available_handles);
+  PREVIOUS (z) = NO_HANDLE;
+  if (NEXT (z) != NO_HANDLE) {
+    PREVIOUS (NEXT (z)) = z;
+  }
+  A68_GC (available_handles) = z;
+  STATUS_CLEAR (z, ALLOCATED_MASK);
+  A68_GC (freed) += SIZE (z);
+  A68_GC (free_handles)++;
+  return y;
+}
+
+//! @brief Link a handle to its neighbours in the list of busy handles.
+
+static void relink_handle (A68_HANDLE * z)
+{
+  if (PREVIOUS (z) == NO_HANDLE) {
+    A68_GC (busy_handles) = z;
+  } else {
+    NEXT (PREVIOUS (z)) = z;
+  }
+  if (NEXT (z) != NO_HANDLE) {
+    PREVIOUS (NEXT (z)) = z;
+  }
+}
+
+//! @brief Exchange the blocks of two busy handles.
+
+void exchange_blocks (A68_HANDLE * x, A68_HANDLE * y)
+{
+// Names refer to handles, so this gives the names of "x" the block of "y" and vice versa.
+// Generation and pins go with a block, and the place in the busy list goes with the generation.
+// Whether the GC is blocked stays with the handle, as the blocker will unblock it.
+  A68_HANDLE z = *x;
+  STATUS_MASK_T bx = STATUS (x) & BLOCK_GC_MASK, by = STATUS (y) & BLOCK_GC_MASK;
+  *x = *y;
+  *y = z;
+  STATUS (x) = (STATUS (x) & ~BLOCK_GC_MASK) | bx;
+  STATUS (y) = (STATUS (y) & ~BLOCK_GC_MASK) | by;
+// When the handles are neighbours, their links now point at themselves.
+  if (NEXT (x) == x) {
+    NEXT (x) = y;
+  }
+  if (PREVIOUS (x) == x) {
+    PREVIOUS (x) = y;
+  }
+  if (NEXT (y) == y) {
+    NEXT (y) = x;
+  }
+  if (PREVIOUS (y) == y) {
+    PREVIOUS (y) = x;
+  }
+  relink_handle (x);
+  relink_handle (y);
+  for (int k = 0; k < A68_GC (pin_count); k++) {
+    if (A68_GC (pins)[k] == x) {
+      A68_GC (pins)[k] = y;
+    } else if (A68_GC (pins)[k] == y) {
+      A68_GC (pins)[k] = x;
+    }
+  }
+}
+
+//! @brief Join active blocks of the young generation and tenure them.
+
+static void defragment_young (void)
+{
+  A68_HANDLE *z = A68_GC (busy_handles), *last = NO_HANDLE;
+// Young handles precede old ones in the busy list.
+  while (z != NO_HANDLE && !(STATUS_TEST (z, OLD_MASK))) {
+    if (!(STATUS_TEST (z, COLOUR_MASK)) && !(STATUS_TEST (z, BLOCK_GC_MASK))) {
+      z = release_handle (z);
+    } else {
+      last = z;
+      FORWARD (z);
+    }
+  }
+// Join young blocks on top of the old generation, in order of allocation.
+  A68_HP = A68_GC (old_heap_pointer);
+  for (z = last; z != NO_HANDLE; BACKWARD (z)) {
+    slide_block (z);
+    STATUS_SET (z, (OLD_MASK | COLOUR_MASK | COOKIE_MASK));
+  }
+  A68_GC (old_heap_pointer) = A68_HP;
+}
+
 //! @brief Join all active blocks in the heap.
 
 void defragment_heap (void)
@@ -349,25 +881,7 @@ void defragment_heap (void)
   z = A68_GC (busy_handles);
   while (z != NO_HANDLE) {
     if (!(STATUS_TEST (z, COLOUR_MASK)) && !(STATUS_TEST (z, BLOCK_GC_MASK))) {
-      A68_HANDLE *y = NEXT (z);
-      if (PREVIOUS (z) == NO_HANDLE) {
-        A68_GC (busy_handles) = NEXT (z);
-      } else {
-        NEXT (PREVIOUS (z)) = NEXT (z);
-      }
-      if (NEXT (z) != NO_HANDLE) {
-        PREVIOUS (NEXT (z)) = PREVIOUS (z);
-      }
-      NEXT (z) = A68_GC (available_handles);
-      PREVIOUS (z) = NO_HANDLE;
-      if (NEXT (z) != NO_HANDLE) {
-        PREVIOUS (NEXT (z)) = z;
-      }
-      A68_GC (available_handles) = z;
-      STATUS_CLEAR (z, ALLOCATED_MASK);
-      A68_GC (freed) += SIZE (z);
-      A68_GC (free_handles)++;
-      z = y;
+      z = release_handle (z);
     } else {
       FORWARD (z);
     }
@@ -382,58 +896,359 @@ void defragment_heap (void)
     ;
   }
   for (; z != NO_HANDLE; BACKWARD (z)) {
-    BYTE_T *dst = HEAP_ADDRESS (A68_HP);
-    if (dst != POINTER (z)) {
-      MOVE (dst, POINTER (z), (unt) SIZE (z));
+// Survivors are tenured; the cookie stops a minor collection from colouring them.
+// Pinned blocks stay where they are. Other blocks fill the room below them, as
+// heap_room skips pins, so the heap pointer ends at the last block that moved.
+    STATUS_SET (z, (OLD_MASK | COLOUR_MASK | COOKIE_MASK));
+    if (!(STATUS_TEST (z, PINNED_MASK))) {
+      slide_block (z);
     }
-    STATUS_CLEAR (z, (COLOUR_MASK | COOKIE_MASK));
-    POINTER (z) = dst;
-    A68_HP += (SIZE (z));
-    ABEND (A68_HP % A68_ALIGNMENT != 0, ERROR_ALIGNMENT, __func__);
   }
+  A68_GC (old_heap_pointer) = A68_HP;
 }
 
-//! @brief Clean up garbage and defragment the heap.
+//! @brief Order handles by the heap offset of their block, handles without one last.
 
-void gc_heap (NODE_T * p, ADDR_T fp)
+static int offset_order (const void *a, const void *b)
+{
+  A68_HANDLE *u = *(A68_HANDLE **) a, *v = *(A68_HANDLE **) b;
+  if (POINTER (u) == NO_BYTE || POINTER (v) == NO_BYTE) {
+    return (POINTER (u) == NO_BYTE) - (POINTER (v) == NO_BYTE);
+  } else {
+    ADDR_T x = heap_offset (POINTER (u)), y = heap_offset (POINTER (v));
+    return (x < y ? -1 : (x > y ? 1 : 0));
+  }
+}
+
+//! @brief Release pinned blocks, restoring the order of busy handles.
+
+static void unpin_blocks (void)
+{
+// Blocks were allocated under pinned blocks, so the busy handles are no longer
+// in order of offset, which compaction needs. Relink them in that order.
+  A68_HANDLE *z, **v;
+  int k, n = 0;
+  if (A68_GC (pin_count) == 0) {
+    return;
+  }
+  for (k = 0; k < A68_GC (pin_count); k++) {
+    STATUS_CLEAR (A68_GC (pins)[k], PINNED_MASK);
+  }
+  a68_free (A68_GC (pins));
+  A68_GC (pins) = NO_VAR;
+  A68_GC (pin_count) = 0;
+  for (z = A68_GC (busy_handles); z != NO_HANDLE; FORWARD (z)) {
+    n++;
+  }
+  v = (A68_HANDLE **) a68_alloc ((size_t) (n + 1) * sizeof (A68_HANDLE *), __func__, __LINE__);
+  for (n = 0, z = A68_GC (busy_handles); z != NO_HANDLE; FORWARD (z)) {
+    v[n++] = z;
+  }
+  qsort (v, (size_t) n, sizeof (A68_HANDLE *), offset_order);
+  A68_GC (busy_handles) = NO_HANDLE;
+  for (k = 0; k < n; k++) {
+    NEXT (v[k]) = A68_GC (busy_handles);
+    PREVIOUS (v[k]) = NO_HANDLE;
+    if (NEXT (v[k]) != NO_HANDLE) {
+      PREVIOUS (NEXT (v[k])) = v[k];
+    }
+    A68_GC (busy_handles) = v[k];
+  }
+  a68_free (v);
+}
+
+//! @brief Fraction of the heap in use.
+
+static REAL_T heap_occupation (void)
+{
+  return (REAL_T) A68_HP / (REAL_T) A68_GC (heap_capacity);
+}
+
+//! @brief Fraction of the handle pool in use.
+
+static REAL_T handle_occupation (void)
+{
+  return (REAL_T) (A68_GC (max_handles) - A68_GC (free_handles)) / (REAL_T) A68_GC (max_handles);
+}
+
+//! @brief Whether heap or handle occupation warrants a collection.
+
+static BOOL_T heap_is_crowded (void)
+{
+  return (BOOL_T) (heap_occupation () > A68_GC (threshold) || handle_occupation () > A68_GC (threshold));
+}
+
+//! @brief Bytes by which to grow the heap after a collection, to make room for a block of "size" bytes.
+
+static ADDR_T heap_growth (ADDR_T size)
+{
+// The heap grows by the fraction of it that survived the last collection, and at
+// least so far that survivors and the block do not fill it beyond the threshold.
+// A segment adds at least a quarter, to bound the number of segments.
+  REAL_T cap = (REAL_T) A68_GC (heap_capacity);
+  REAL_T len = MAX (A68_GC (survival) * cap, (REAL_T) (A68_HP + size) / DEFAULT_PREEMPTIVE - cap);
+  return (ADDR_T) MAX (len, cap / 4);
+}
+
+//! @brief After a major collection, size heap and handle pool, and set the next threshold.
+
+static void adapt_heap (void)
+{
+// Grow the heap when collecting left it crowded, or when most data survives while
+// collections take too large a share of run time at the present allocation rate.
+// Otherwise, give back segments that are not needed.
+  REAL_T fill = (A68_GC (rate) > 0 ? (REAL_T) heap_available () / A68_GC (rate) : 0);
+  REAL_T share = (fill > 0 ? A68_GC (last_seconds) / (A68_GC (last_seconds) + fill) : 0);
+  if (heap_occupation () > A68_GC (threshold) || (A68_GC (survival) > 0.5 && share > DEFAULT_GC_SHARE)) {
+    (void) grow_heap (0, heap_growth (0));
+  } else {
+    shrink_heap ();
+  }
+  if (handle_occupation () > A68_GC (threshold)) {
+    (void) grow_handles ();
+  }
+// When heap or handle pool cannot grow, the next collection comes when half of the
+// remaining room is used, so a crowded heap does not trigger a collection per allocation.
+  REAL_T f = MAX (heap_occupation (), handle_occupation ());
+  A68_GC (threshold) = MAX (DEFAULT_PREEMPTIVE, f + (1 - f) / 2);
+}
+
+//! @brief Whether a collection cannot be done now.
+
+static BOOL_T gc_refused (void)
 {
-// Must start with fp = current frame_pointer.
-  A68_HANDLE *z;
-  REAL_T t0, t1;
 #if defined (BUILD_PARALLEL_CLAUSE)
   if (OTHER_THREAD (FRAME_THREAD_ID (A68_FP), A68_PAR (main_thread_id))) {
     A68_GC (refused)++;
-    return;
+    return A68_TRUE;
   }
 #endif
 // Take no risk when intermediate results are on the stack.
   if (A68_SP != A68 (stack_start)) {
     A68_GC (refused)++;
-    return;
+    return A68_TRUE;
   }
-// Give it a whirl then.
-  t0 = seconds ();
-// Unfree handles are subject to inspection.
-// Release them all before colouring.
-  for (z = A68_GC (busy_handles); z != NO_HANDLE; FORWARD (z)) {
-    STATUS_CLEAR (z, (COLOUR_MASK | COOKIE_MASK));
+  return A68_FALSE;
+}
+
+//! @brief Note the allocation rate at the start of a collection.
+
+static void start_collection (void)
+{
+// Bytes per second since the previous collection, smoothed.
+  REAL_T dt = seconds () - A68_GC (mutator_start);
+  if (dt > 0) {
+    REAL_T r = (REAL_T) A68_GC (allocated) / dt;
+    A68_GC (rate) = (A68_GC (rate) > 0 ? (A68_GC (rate) + r) / 2 : r);
   }
-// Pour paint into the heap to reveal active objects.
-  colour_heap (fp);
-// Start freeing and compacting.
+  A68_GC (allocated) = 0;
   A68_GC (freed) = 0;
-  defragment_heap ();
-// Stats and logging.
+}
+
+//! @brief Stats of a collection that started at "t0" and inspected "size" bytes.
+
+static void end_collection (REAL_T t0, ADDR_T size)
+{
+  REAL_T t1 = seconds (), dt;
   A68_GC (total) += A68_GC (freed);
   A68_GC (sweeps)++;
-  A68_GC (preemptive) = A68_FALSE;
-  t1 = seconds ();
+  A68_GC (survival) = (size > 0 ? 1 - (REAL_T) A68_GC (freed) / (REAL_T) size : 1);
 // C optimiser can make last digit differ, so next condition is 
 // needed to determine a positive time difference
   if ((t1 - t0) > ((REAL_T) A68 (clock_res) / 2.0)) {
-    A68_GC (seconds) += (t1 - t0);
+    dt = t1 - t0;
+  } else {
+    dt = (REAL_T) A68 (clock_res) / 2.0;
+  }
+  A68_GC (seconds) += dt;
+  A68_GC (last_seconds) = dt;
+  A68_GC (mutator_start) = t1;
+}
+
+//! @brief Collect either the young generation or the whole heap.
+
+static void collect_heap (ADDR_T fp, BOOL_T minor)
+{
+  REAL_T t0 = seconds ();
+  ADDR_T size;
+  start_collection ();
+  if (minor) {
+// Young handles have no colour yet. Colour from the frames, then from the old generation.
+    size = A68_HP - A68_GC (old_heap_pointer);
+    colour_heap (fp);
+    colour_old_generation ();
+    defragment_young ();
+    A68_GC (minor_total) += A68_GC (freed);
+    A68_GC (minor_sweeps)++;
+  } else {
+// Unfree handles are subject to inspection.
+// Release them all before colouring.
+    A68_HANDLE *z;
+    size = A68_HP - A68 (fixed_heap_pointer);
+    unpin_blocks ();
+    for (z = A68_GC (busy_handles); z != NO_HANDLE; FORWARD (z)) {
+      STATUS_CLEAR (z, (COLOUR_MASK | COOKIE_MASK));
+    }
+// Pour paint into the heap to reveal active objects.
+    colour_heap (fp);
+// Start freeing and compacting.
+    defragment_heap ();
+  }
+// Stats and logging.
+  A68_GC (preemptive) = A68_FALSE;
+  end_collection (t0, size);
+  if (!minor) {
+    adapt_heap ();
+  }
+}
+
+//! @brief Order handles by the address of their block.
+
+static int pin_order (const void *a, const void *b)
+{
+  BYTE_T *u = POINTER (*(A68_HANDLE **) a), *v = POINTER (*(A68_HANDLE **) b);
+  return (u < v ? -1 : (u > v ? 1 : 0));
+}
+
+//! @brief Pin blocks that an address in a stretch of memory points into.
+
+static void pin_words (A68_HANDLE ** pins, int n, BYTE_T * u, ADDR_T size)
+{
+// An address just past a block may be the end of a pointer walk, so it pins as well.
+  ADDR_T k;
+  for (k = 0; k + sizeof (BYTE_T *) <= size; k += sizeof (BYTE_T *)) {
+    BYTE_T *w = *(BYTE_T **) & u[k];
+    int lwb = 0, upb = n - 1, j;
+    if (n == 0 || w < POINTER (pins[0]) || w > POINTER (pins[n - 1]) + SIZE (pins[n - 1])) {
+      continue;
+    }
+    while (lwb < upb) {
+      int mid = (lwb + upb + 1) / 2;
+      if (POINTER (pins[mid]) <= w) {
+        lwb = mid;
+      } else {
+        upb = mid - 1;
+      }
+    }
+    for (j = lwb; j >= 0 && j >= lwb - 1; j--) {
+      A68_HANDLE *z = pins[j];
+      if (w >= POINTER (z) && w <= POINTER (z) + SIZE (z) && !(STATUS_TEST (z, PINNED_MASK))) {
+        STATUS_SET (z, PINNED_MASK);
+        if (!(STATUS_TEST (z, COOKIE_MASK))) {
+          STATUS_SET (z, (COOKIE_MASK | COLOUR_MASK));
+          colour_words (POINTER (z), (ADDR_T) SIZE (z));
+        }
+      }
+    }
+  }
+}
+
+//! @brief Address of the frame of this function, below the frame of its caller.
+
+static BYTE_T * __attribute__ ((noinline)) stack_pointer (void)
+{
+  return (BYTE_T *) __builtin_frame_address (0);
+}
+
+//! @brief Collect the whole heap when an allocation finds no room.
+
+static void collect_on_allocation (void)
+{
+// Names held in C variables or in the stacks are found by scanning those word by word,
+// as for the old generation. The caller may hold raw addresses into blocks, so blocks
+// that such words point into are pinned and stay in place while the rest is compacted.
+  if (A68 (heap_is_fluid)) {
+    return;
+  }
+#if defined (BUILD_PARALLEL_CLAUSE)
+  if (!is_main_thread () || A68_PAR (context_index) > 0) {
+    A68_GC (refused)++;
+    return;
+  }
+#endif
+  A68_HANDLE *z, **pins;
+  int k, n = 0;
+  unpin_blocks ();
+  for (z = A68_GC (busy_handles); z != NO_HANDLE; FORWARD (z)) {
+    n++;
+  }
+  pins = (A68_HANDLE **) a68_alloc ((size_t) (n + 1) * sizeof (A68_HANDLE *), __func__, __LINE__);
+  REAL_T t0 = seconds ();
+  start_collection ();
+  n = 0;
+  for (z = A68_GC (busy_handles); z != NO_HANDLE; FORWARD (z)) {
+    STATUS_CLEAR (z, (COLOUR_MASK | COOKIE_MASK | PINNED_MASK));
+    if (POINTER (z) != NO_BYTE && SIZE (z) > 0) {
+      pins[n++] = z;
+    }
+  }
+  qsort (pins, (size_t) n, sizeof (A68_HANDLE *), pin_order);
+// Spill callee-saved registers into this frame, and scan the C stack from below it
+// up to where the genie started. A jmp_buf is no help, as it may hold registers mangled.
+  __builtin_unwind_init ();
+  BYTE_T *sp = stack_pointer ();
+  BYTE_T *lwb = MIN (sp, A68 (system_stack_offset));
+  BYTE_T *upb = MAX (sp, A68 (system_stack_offset));
+  lwb += (sizeof (BYTE_T *) - (ADDR_T) lwb % sizeof (BYTE_T *)) % sizeof (BYTE_T *);
+  BYTE_T *frames = STACK_ADDRESS (A68 (frame_start)), *stack = STACK_ADDRESS (A68 (stack_start));
+  ADDR_T frames_size = A68_FP + FRAME_SIZE (A68_FP) - A68 (frame_start), stack_size = A68_SP - A68 (stack_start);
+  pin_words (pins, n, lwb, (ADDR_T) (upb - lwb));
+  pin_words (pins, n, frames, frames_size);
+  pin_words (pins, n, stack, stack_size);
+// Keep the pins in order of offset, for heap_room to allocate around them.
+  int m = 0;
+  for (k = 0; k < n; k++) {
+    if (STATUS_TEST (pins[k], PINNED_MASK)) {
+      pins[m++] = pins[k];
+    }
+  }
+  if (m > 0) {
+    qsort (pins, (size_t) m, sizeof (A68_HANDLE *), offset_order);
+    A68_GC (pins) = pins;
+    A68_GC (pin_count) = m;
   } else {
-    A68_GC (seconds) += ((REAL_T) A68 (clock_res) / 2.0);
+    a68_free (pins);
+  }
+// Colour from the frames, then from the stacks.
+  colour_heap (A68_FP);
+  colour_words (frames, frames_size);
+  colour_words (stack, stack_size);
+  colour_words (lwb, (ADDR_T) (upb - lwb));
+  defragment_heap ();
+  A68_GC (allocation_sweeps)++;
+  A68_GC (preemptive) = A68_FALSE;
+  end_collection (t0, A68_GC (freed) + A68_HP - A68 (fixed_heap_pointer));
+  adapt_heap ();
+}
+
+//! @brief Clean up garbage and defragment the heap.
+
+void gc_heap (NODE_T * p, ADDR_T fp)
+{
+// Must start with fp = current frame_pointer.
+  if (gc_refused ()) {
+    return;
+  }
+// Give it a whirl then.
+  collect_heap (fp, A68_FALSE);
+// Call the event handler.
+  genie_call_event_routine (p, M_PROC_VOID, &A68 (on_gc_event), A68_SP, A68_FP);
+}
+
+//! @brief Collect the young generation, and the whole heap if that does not suffice.
+
+void gc_heap_minor (NODE_T * p, ADDR_T fp)
+{
+// Must start with fp = current frame_pointer.
+  if (gc_refused ()) {
+    return;
+  }
+// A minor collection cannot help when the old generation itself fills the heap.
+  if ((REAL_T) A68_GC (old_heap_pointer) / (REAL_T) A68_GC (heap_capacity) <= A68_GC (threshold)) {
+    collect_heap (fp, A68_TRUE);
+  }
+  if (heap_is_crowded ()) {
+    collect_heap (fp, A68_FALSE);
   }
 // Call the event handler.
   genie_call_event_routine (p, M_PROC_VOID, &A68 (on_gc_event), A68_SP, A68_FP);
@@ -443,15 +1258,35 @@ void gc_heap (NODE_T * p, ADDR_T fp)
 
 A68_HANDLE *give_handle (NODE_T * p, MOID_T * a68m)
 {
-  if (A68_GC (available_handles) != NO_HANDLE) {
-    A68_HANDLE *x = A68_GC (available_handles);
-    A68_GC (available_handles) = NEXT (x);
+// When the pool is exhausted, collect if that can be done now,
+// and grow the pool when that frees no handle.
+  if (A68_GC (available_handles) == NO_HANDLE && A68_GC (fresh_handles) >= A68_GC (max_handles)) {
+    collect_on_allocation ();
+    if (A68_GC (available_handles) == NO_HANDLE && A68_GC (fresh_handles) >= A68_GC (max_handles)) {
+      (void) grow_handles ();
+    }
+  }
+  if (A68_GC (available_handles) != NO_HANDLE || A68_GC (fresh_handles) < A68_GC (max_handles)) {
+    A68_HANDLE *x;
     if (A68_GC (available_handles) != NO_HANDLE) {
-      PREVIOUS (A68_GC (available_handles)) = NO_HANDLE;
+      x = A68_GC (available_handles);
+      A68_GC (available_handles) = NEXT (x);
+      if (A68_GC (available_handles) != NO_HANDLE) {
+        PREVIOUS (A68_GC (available_handles)) = NO_HANDLE;
+      }
+    } else {
+// Fresh handles are handed out in order, mostly from the last segment.
+      int k = A68_GC (handle_segment_count) - 1;
+      while (k > 0 && A68_GC (fresh_handles) < BASE (&(A68_GC (handle_segments)[k]))) {
+        k--;
+      }
+      HEAP_SEGMENT_T *s = &(A68_GC (handle_segments)[k]);
+      x = &(((A68_HANDLE *) START (s))[A68_GC (fresh_handles)++ - BASE (s)]);
     }
     STATUS (x) = ALLOCATED_MASK;
     POINTER (x) = NO_BYTE;
     SIZE (x) = 0;
+    USED (x) = 0;
     MOID (x) = a68m;
     NEXT (x) = A68_GC (busy_handles);
     PREVIOUS (x) = NO_HANDLE;
@@ -462,7 +1297,6 @@ A68_HANDLE *give_handle (NODE_T * p, MOID_T * a68m)
     A68_GC (free_handles)--;
     return x;
   } else {
-// Do not auto-GC!.
     diagnostic (A68_RUNTIME_ERROR, p, ERROR_OUT_OF_CORE);
     exit_genie (p, A68_RUNTIME_ERROR);
   }
@@ -476,28 +1310,35 @@ A68_REF heap_generator (NODE_T * p, MOID_T * mode, int size)
 // Align.
   ABEND (size < 0, ERROR_INVALID_SIZE, __func__);
   size = A68_ALIGN (size);
-// Now give it.
-  if (heap_available () >= size) {
-    A68_HANDLE *x;
+// Now give it. When the heap is full, collect if that can be done now, and grow
+// the heap by what survived when that does not make room.
+// The new handle is blocked meanwhile, as the caller does not hold it yet.
+  A68_HANDLE *x = give_handle (p, mode);
+  STATUS_SET (x, BLOCK_GC_MASK);
+  BYTE_T *dst = heap_room ((ADDR_T) size, 0);
+  if (dst == NO_BYTE) {
+    collect_on_allocation ();
+    dst = heap_room ((ADDR_T) size, heap_growth ((ADDR_T) size));
+  }
+// A collection tenured the handle, but its block is young.
+  STATUS (x) = ALLOCATED_MASK;
+  if (dst != NO_BYTE) {
     A68_REF z;
     STATUS (&z) = (STATUS_MASK_T) (INIT_MASK | IN_HEAP_MASK);
     OFFSET (&z) = 0;
-    x = give_handle (p, mode);
     SIZE (x) = size;
-    POINTER (x) = HEAP_ADDRESS (A68_HP);
+    POINTER (x) = dst;
     FILL (POINTER (x), 0, size);
     REF_SCOPE (&z) = PRIMAL_SCOPE;
     REF_HANDLE (&z) = x;
     ABEND (((long) ADDRESS (&z)) % A68_ALIGNMENT != 0, ERROR_ALIGNMENT, __func__);
     A68_HP += size;
-    REAL_T _f_ = (REAL_T) A68_HP / (REAL_T) A68 (heap_size);
-    REAL_T _g_ = (REAL_T) (A68_GC (max_handles) - A68_GC (free_handles)) / (REAL_T) A68_GC (max_handles);
-    if (_f_ > DEFAULT_PREEMPTIVE || _g_ > DEFAULT_PREEMPTIVE) {
+    A68_GC (allocated) += size;
+    if (heap_is_crowded ()) {
       A68_GC (preemptive) = A68_TRUE;
     }
     return z;
   } else {
-// Do not auto-GC!.
     diagnostic (A68_RUNTIME_ERROR, p, ERROR_OUT_OF_CORE);
     exit_genie (p, A68_RUNTIME_ERROR);
     return nil_ref;
@@ -714,7 +1555,7 @@ void genie_generator_internal (NODE_T * p, MOID_T * ref_mode, TAG_T * tag, LEAP_
   } else if (leap == -LOC_SYMBOL && NON_LOCAL (p) != NO_TABLE) {
     ADDR_T lev;
     name = heap_generator (p, mode, SIZE (mode));
-    FOLLOW_SL (lev, LEVEL (NON_LOCAL (p)));
+    FOLLOW_SL (lev, DEPTH (NON_LOCAL (p)));
     REF_SCOPE (&name) = lev;
   } else if (leap == -LOC_SYMBOL) {
     name = heap_generator (p, mode, SIZE (mode));
@@ -760,6 +1601,14 @@ PROP_T genie_generator (NODE_T * p)
 
 void discard_heap (void)
 {
+  a68_free (A68_GC (pins));
+  A68_GC (pins) = NO_VAR;
+  A68_GC (pin_count) = 0;
+  a68_free (A68_GC (marks));
+  A68_GC (marks) = NO_VAR;
+  A68_GC (mark_count) = 0;
+  A68_GC (max_marks) = 0;
+  unmap_heap_segments ();
   if (A68_HEAP != NO_BYTE) {
     a68_free (A68_HEAP);
   }
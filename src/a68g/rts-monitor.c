@@ -698,12 +698,21 @@ void slice (FILE_T f, NODE_T * p, int depth)
   }
   address = ROW_ELEMENT (arr, iindex);
   if (name) {
+// Elements of a name are addressed as A68_CHARs, so unpack the block.
+    if (PACKED_ROW (&ARRAY (arr))) {
+      PUSH_REF (p, z);
+      unpack_row (p, &ARRAY (arr));
+      DECREMENT_STACK_POINTER (p, A68_REF_SIZE);
+      GET_DESCRIPTOR (arr, tup, &z);
+    }
     z = ARRAY (arr);
     OFFSET (&z) += address;
     REF_SCOPE (&z) = PRIMAL_SCOPE;
     PUSH_REF (p, z);
   } else {
-    PUSH (p, ADDRESS (&(ARRAY (arr))) + address, SIZE (res));
+    z = ARRAY (arr);
+    OFFSET (&z) += address;
+    PUSH_ROW_ELEMENT (p, &z, SIZE (res));
   }
   push_mode (f, res);
 }
@@ -1348,6 +1357,7 @@ void show_item (FILE_T f, NODE_T * p, BYTE_T * item, MOID_T * mode)
       A68_TUPLE *tup;
       int count = 0, act_count = 0, elems;
       GET_DESCRIPTOR (arr, tup, (A68_REF *) item);
+      UNPACK_ROW (p, arr, tup, (A68_REF *) item);
       elems = get_row_size (tup, DIM (arr));
       ASSERT (snprintf (A68 (output_line), SNPRINTF_SIZE, ", %d element(s)", elems) >= 0);
       WRITE (f, A68 (output_line));
@@ -1567,7 +1577,7 @@ void show_heap (FILE_T f, NODE_T * p, A68_HANDLE * z, int top, int n)
 {
   int k = 0, m = n, sum = 0;
   (void) p;
-  ASSERT (snprintf (A68 (output_line), SNPRINTF_SIZE, "size=%u available=%d garbage collections=" A68_LD, A68 (heap_size), heap_available (), A68_GC (sweeps)) >= 0);
+  ASSERT (snprintf (A68 (output_line), SNPRINTF_SIZE, "size=" A68_LU " available=" A68_LU " garbage collections=" A68_LD, A68_GC (heap_capacity), heap_available (), A68_GC (sweeps)) >= 0);
   WRITELN (f, A68 (output_line));
   for (; z != NO_HANDLE; FORWARD (z), k++) {
     if (n > 0 && sum <= top) {
@@ -2045,7 +2055,7 @@ BOOL_T single_stepper (NODE_T * p, char *cmd)
     WRITELN (STDOUT_FILENO, A68 (output_line));
     ASSERT (snprintf (A68 (output_line), SNPRINTF_SIZE, "Expression stack pointer=" A68_LU " available=" A68_LU, A68_SP, (UNSIGNED_T) (A68 (expr_stack_size) - A68_SP)) >= 0);
     WRITELN (STDOUT_FILENO, A68 (output_line));
-    ASSERT (snprintf (A68 (output_line), SNPRINTF_SIZE, "Heap size=%u available=%u", A68 (heap_size), heap_available ()) >= 0);
+    ASSERT (snprintf (A68 (output_line), SNPRINTF_SIZE, "Heap size=" A68_LU " available=" A68_LU, A68_GC (heap_capacity), heap_available ()) >= 0);
     WRITELN (STDOUT_FILENO, A68 (output_line));
     ASSERT (snprintf (A68 (output_line), SNPRINTF_SIZE, "Garbage collections=" A68_LD, A68_GC (sweeps)) >= 0);
     WRITELN (STDOUT_FILENO, A68 (output_line));
@@ -43,10 +43,18 @@
 
 #if defined (BUILD_PARALLEL_CLAUSE)
 
-// static pthread_mutex_t unit_sema = PTHREAD_MUTEX_INITIALIZER;
-
 void save_stacks (pthread_t);
 void restore_stacks (pthread_t);
+void start_parallel_units (NODE_T *, pthread_t);
+
+// Units run on a pool of worker threads. A worker that completed a unit awaits
+// the next one, so a parallel clause in a loop does not create and join a thread
+// for every unit on every iteration. The pool grows when no worker is idle,
+// since all units must be able to run - they may await each other through SEMAs.
+//
+// Threads take turns through the unit_sema mutex, since they share the stacks.
+// When a thread yields, its stacks stay in place. They are swapped out only when
+// another thread takes over, not when the same thread takes up the mutex again.
 
 #define SAVE_STACK(stk, st, si) {\
   A68_STACK_DESCRIPTOR *s = (stk);\
@@ -83,7 +91,7 @@ void restore_stacks (pthread_t);
   pthread_t _tid_ = (ptid);\
   (z) = -1;\
   for (_k_ = 0; _k_ < A68_PAR (context_index) && (z) == -1; _k_++) {\
-    if (SAME_THREAD (_tid_, ID (&(A68_PAR (context)[_k_])))) {\
+    if (ACTIVE (&(A68_PAR (context)[_k_])) && SAME_THREAD (_tid_, ID (&(A68_PAR (context)[_k_])))) {\
       (z) = _k_;\
     }\
   }\
@@ -100,6 +108,14 @@ void restore_stacks (pthread_t);
   ABEND (pthread_mutex_unlock (&A68_PAR (unit_sema)) != 0, ERROR_THREAD_FAULT, __func__);\
   }
 
+#define LOCK_POOL {\
+  ABEND (pthread_mutex_lock (&A68_PAR (pool_sema)) != 0, ERROR_THREAD_FAULT, __func__);\
+  }
+
+#define UNLOCK_POOL {\
+  ABEND (pthread_mutex_unlock (&A68_PAR (pool_sema)) != 0, ERROR_THREAD_FAULT, __func__);\
+  }
+
 //! @brief Does system stack grow up or down?.
 
 static inline int stack_direction (BYTE_T * lwb)
@@ -127,10 +143,20 @@ BOOL_T is_main_thread (void)
 void genie_abend_thread (void)
 {
   int k;
+  A68_THREAD_CONTEXT *u;
+  jmp_buf *exit_jump;
   GET_THREAD_INDEX (k, pthread_self ());
-  ACTIVE (&(A68_PAR (context)[k])) = A68_FALSE;
+  u = &(A68_PAR (context)[k]);
+// Once the unit_sema is released, the context may be reused.
+  exit_jump = THREAD_EXIT (u);
+  ACTIVE (u) = A68_FALSE;
+  if (A68_PAR (stack_owner) == k) {
+    A68_PAR (stack_owner) = -1;
+  }
+  ABEND (pthread_cond_broadcast (&A68_PAR (unit_cond)) != 0, ERROR_THREAD_FAULT, __func__);
   UNLOCK_THREAD;
-  pthread_exit (NULL);
+// Return to the pool.
+  longjmp (*exit_jump, 1);
 }
 
 //! @brief When we end execution in a parallel clause we zap all threads.
@@ -157,6 +183,25 @@ void genie_abend_all_threads (NODE_T * p, jmp_buf * jump_stat, NODE_T * label)
   }
 }
 
+//! @brief Copy the stacks of a thread to its swap buffers.
+
+static void swap_out_stacks (int k)
+{
+  A68_THREAD_CONTEXT *u = &(A68_PAR (context)[k]);
+  ADDR_T p, q, w, v;
+// Swap out evaluation stack.
+  p = CUR_PTR (&STACK (u));
+  q = INI_PTR (&STACK (u));
+  SAVE_STACK (&(STACK (u)), STACK_ADDRESS (q), p - q);
+// Swap out frame stack.
+  p = CUR_PTR (&FRAME (u));
+  q = INI_PTR (&FRAME (u));
+  w = p + FRAME_SIZE (p);
+  v = q + FRAME_SIZE (q);
+// Consider the embedding thread.
+  SAVE_STACK (&(FRAME (u)), FRAME_ADDRESS (v), w - v);
+}
+
 //! @brief Save this thread and try to start another.
 
 void try_change_thread (NODE_T * p)
@@ -165,36 +210,44 @@ void try_change_thread (NODE_T * p)
     diagnostic (A68_RUNTIME_ERROR, p, ERROR_PARALLEL_OUTSIDE);
     exit_genie (p, A68_RUNTIME_ERROR);
   } else {
-// Release the unit_sema so another thread can take it up ...
+// Release the unit_sema so another thread can take it up, 
+// and take it up again when a thread ends or ups a SEMA.
+    save_stacks (pthread_self ());
+    ABEND (pthread_cond_wait (&A68_PAR (unit_cond), &A68_PAR (unit_sema)) != 0, ERROR_THREAD_FAULT, __func__);
+    restore_stacks (pthread_self ());
+  }
+}
+
+//! @brief Let other units run while this thread blocks outside the interpreter.
+
+void release_thread (void)
+{
+// The main thread only runs when no units are active.
+  if (!is_main_thread ()) {
     save_stacks (pthread_self ());
     UNLOCK_THREAD;
-// ... and take it up again!.
+  }
+}
+
+//! @brief Resume this thread after it blocked outside the interpreter.
+
+void resume_thread (void)
+{
+  if (!is_main_thread ()) {
     LOCK_THREAD;
     restore_stacks (pthread_self ());
   }
 }
 
-//! @brief Store the stacks of threads.
+//! @brief Store the stacks of a thread that yields.
 
 void save_stacks (pthread_t t)
 {
-  ADDR_T p, q, u, v;
   int k;
   GET_THREAD_INDEX (k, t);
-// Store stack pointers.
+// Store stack pointers; the stacks are swapped out when another thread takes over.
   CUR_PTR (&FRAME (&(A68_PAR (context)[k]))) = A68_FP;
   CUR_PTR (&STACK (&(A68_PAR (context)[k]))) = A68_SP;
-// Swap out evaluation stack.
-  p = A68_SP;
-  q = INI_PTR (&STACK (&(A68_PAR (context)[k])));
-  SAVE_STACK (&(STACK (&(A68_PAR (context)[k]))), STACK_ADDRESS (q), p - q);
-// Swap out frame stack.
-  p = A68_FP;
-  q = INI_PTR (&FRAME (&(A68_PAR (context)[k])));
-  u = p + FRAME_SIZE (p);
-  v = q + FRAME_SIZE (q);
-// Consider the embedding thread.
-  SAVE_STACK (&(FRAME (&(A68_PAR (context)[k]))), FRAME_ADDRESS (v), u - v);
 }
 
 //! @brief Restore stacks of thread.
@@ -206,14 +259,21 @@ void restore_stacks (pthread_t t)
   } else {
     int k;
     GET_THREAD_INDEX (k, t);
+// Swap stacks only when another thread ran meanwhile.
+    if (A68_PAR (stack_owner) != k) {
+      if (A68_PAR (stack_owner) >= 0) {
+        swap_out_stacks (A68_PAR (stack_owner));
+      }
+      RESTORE_STACK (&(STACK (&(A68_PAR (context)[k]))));
+      RESTORE_STACK (&(FRAME (&(A68_PAR (context)[k]))));
+      A68_PAR (stack_owner) = k;
+    }
 // Restore stack pointers.
     get_stack_size ();
     A68 (system_stack_offset) = THREAD_STACK_OFFSET (&(A68_PAR (context)[k]));
     A68_FP = CUR_PTR (&FRAME (&(A68_PAR (context)[k])));
+    SET_DISPLAY (-1);
     A68_SP = CUR_PTR (&STACK (&(A68_PAR (context)[k])));
-// Restore stacks.
-    RESTORE_STACK (&(STACK (&(A68_PAR (context)[k]))));
-    RESTORE_STACK (&(FRAME (&(A68_PAR (context)[k]))));
   }
 }
 
@@ -229,118 +289,161 @@ void check_parallel_units (BOOL_T * active, pthread_t parent)
   }
 }
 
-//! @brief Execute one unit from a PAR clause.
+//! @brief Execute a unit from a PAR clause in a worker thread.
 
-void *start_unit (void *arg)
+static void run_unit (int k)
+{
+  NODE_T *p = (NODE_T *) (UNIT (&(A68_PAR (context)[k])));
+  if (k == 0) {
+// This is the unit passed by the main thread, we spawn parallel units and await their completion.
+    BOOL_T units_active;
+    start_parallel_units (SUB (p), pthread_self ());
+    do {
+      units_active = A68_FALSE;
+      check_parallel_units (&units_active, pthread_self ());
+      if (units_active) {
+        try_change_thread (p);
+      }
+    } while (units_active);
+  } else {
+    EXECUTE_UNIT_TRACE (p);
+  }
+  genie_abend_thread ();
+}
+
+//! @brief Worker thread that executes units from PAR clauses.
+
+static void *pool_worker (void *arg)
 {
-  pthread_t t;
-  int k;
   BYTE_T stack_offset;
-  NODE_T *p;
   (void) arg;
-  LOCK_THREAD;
-  t = pthread_self ();
-  GET_THREAD_INDEX (k, t);
-  THREAD_STACK_OFFSET (&(A68_PAR (context)[k])) = (BYTE_T *) (&stack_offset - stack_direction (&stack_offset) * STACK_USED (&A68_PAR (context)[k]));
-  restore_stacks (t);
-  p = (NODE_T *) (UNIT (&(A68_PAR (context)[k])));
-  EXECUTE_UNIT_TRACE (p);
-  genie_abend_thread ();
+  while (A68_TRUE) {
+    jmp_buf exit_jump;
+    A68_THREAD_CONTEXT *u;
+    int k;
+// Await a unit.
+    LOCK_POOL;
+    A68_PAR (pool_idle)++;
+    while (A68_PAR (pool_head) == A68_PAR (pool_tail)) {
+      ABEND (pthread_cond_wait (&A68_PAR (pool_cond), &A68_PAR (pool_sema)) != 0, ERROR_THREAD_FAULT, __func__);
+    }
+    A68_PAR (pool_idle)--;
+    k = A68_PAR (pool_queue)[A68_PAR (pool_head) % THREAD_MAX];
+    A68_PAR (pool_head)++;
+    UNLOCK_POOL;
+// Execute it; the thread returns here when the unit ends.
+    u = &(A68_PAR (context)[k]);
+    if (setjmp (exit_jump) == 0) {
+      LOCK_THREAD;
+      ID (u) = pthread_self ();
+      THREAD_EXIT (u) = &exit_jump;
+      THREAD_STACK_OFFSET (u) = (BYTE_T *) (&stack_offset - stack_direction (&stack_offset) * STACK_USED (u));
+      restore_stacks (ID (u));
+      run_unit (k);
+    }
+  }
   return (void *) NULL;
 }
 
+//! @brief Add a worker thread to the pool.
+
+static void pool_spawn (NODE_T * p)
+{
+  pthread_t new_id;
+  pthread_attr_t new_at;
+  size_t ss;
+  errno = 0;
+  if (pthread_attr_init (&new_at) != 0) {
+    diagnostic (A68_RUNTIME_ERROR, p, ERROR_THREAD_FAULT);
+    exit_genie (p, A68_RUNTIME_ERROR);
+  }
+  if (pthread_attr_setstacksize (&new_at, (size_t) A68 (stack_size)) != 0) {
+    diagnostic (A68_RUNTIME_ERROR, p, ERROR_THREAD_FAULT);
+    exit_genie (p, A68_RUNTIME_ERROR);
+  }
+  if (pthread_attr_getstacksize (&new_at, &ss) != 0) {
+    diagnostic (A68_RUNTIME_ERROR, p, ERROR_THREAD_FAULT);
+    exit_genie (p, A68_RUNTIME_ERROR);
+  }
+  ABEND ((size_t) ss != (size_t) A68 (stack_size), ERROR_ACTION, __func__);
+  if (pthread_attr_setdetachstate (&new_at, PTHREAD_CREATE_DETACHED) != 0) {
+    diagnostic (A68_RUNTIME_ERROR, p, ERROR_THREAD_FAULT);
+    exit_genie (p, A68_RUNTIME_ERROR);
+  }
+  if (pthread_create (&new_id, &new_at, pool_worker, NULL) != 0) {
+    diagnostic (A68_RUNTIME_ERROR, p, ERROR_PARALLEL_CANNOT_CREATE);
+    exit_genie (p, A68_RUNTIME_ERROR);
+  }
+  (void) pthread_attr_destroy (&new_at);
+}
+
+//! @brief Pass a unit to the pool, and add a worker when none is idle.
+
+static void pool_dispatch (NODE_T * p, int k)
+{
+  BOOL_T spawn;
+  LOCK_POOL;
+  A68_PAR (pool_queue)[A68_PAR (pool_tail) % THREAD_MAX] = k;
+  A68_PAR (pool_tail)++;
+  spawn = (BOOL_T) (A68_PAR (pool_tail) - A68_PAR (pool_head) > (unt) A68_PAR (pool_idle));
+  ABEND (pthread_cond_signal (&A68_PAR (pool_cond)) != 0, ERROR_THREAD_FAULT, __func__);
+  UNLOCK_POOL;
+  if (spawn) {
+    pool_spawn (p);
+  }
+}
+
+//! @brief Set up a context for a unit, starting from the stacks of the current thread.
+
+static A68_THREAD_CONTEXT *new_context (NODE_T * p, pthread_t parent)
+{
+  BYTE_T stack_offset;
+  A68_THREAD_CONTEXT *u;
+  if (A68_PAR (context_index) >= THREAD_MAX) {
+    static BUFFER msg;
+    snprintf (msg, SNPRINTF_SIZE, "platform supports %d parallel units", THREAD_MAX);
+    diagnostic (A68_RUNTIME_ERROR, p, ERROR_PARALLEL_OVERFLOW, msg);
+    exit_genie (p, A68_RUNTIME_ERROR);
+  }
+// Fill out a context for this unit.
+  u = &((A68_PAR (context)[A68_PAR (context_index)]));
+  UNIT (u) = p;
+  STACK_USED (u) = SYSTEM_STACK_USED;
+  THREAD_STACK_OFFSET (u) = NO_BYTE;
+  THREAD_EXIT (u) = NO_JMP_BUF;
+  CUR_PTR (&STACK (u)) = A68_SP;
+  CUR_PTR (&FRAME (u)) = A68_FP;
+  INI_PTR (&STACK (u)) = A68_PAR (sp0);
+  INI_PTR (&FRAME (u)) = A68_PAR (fp0);
+  SWAP (&STACK (u)) = NO_BYTE;
+  SWAP (&FRAME (u)) = NO_BYTE;
+  START (&STACK (u)) = NO_BYTE;
+  START (&FRAME (u)) = NO_BYTE;
+  BYTES (&STACK (u)) = 0;
+  BYTES (&FRAME (u)) = 0;
+  ACTIVE (u) = A68_TRUE;
+// The worker that takes up the unit sets the thread id.
+  PARENT (u) = parent;
+  ID (u) = parent;
+  swap_out_stacks (A68_PAR (context_index));
+  A68_PAR (context_index)++;
+  return u;
+}
+
 //! @brief Execute parallel units.
 
 void start_parallel_units (NODE_T * p, pthread_t parent)
 {
   for (; p != NO_NODE; FORWARD (p)) {
     if (IS (p, UNIT)) {
-      pthread_t new_id;
-      pthread_attr_t new_at;
-      size_t ss;
-      BYTE_T stack_offset;
-      A68_THREAD_CONTEXT *u;
-// Set up a thread for this unit.
-      if (A68_PAR (context_index) >= THREAD_MAX) {
-        static BUFFER msg;
-        snprintf (msg, SNPRINTF_SIZE, "platform supports %d parallel units", THREAD_MAX);
-        diagnostic (A68_RUNTIME_ERROR, p, ERROR_PARALLEL_OVERFLOW, msg);
-        exit_genie (p, A68_RUNTIME_ERROR);
-      }
-// Fill out a context for this thread.
-      u = &((A68_PAR (context)[A68_PAR (context_index)]));
-      UNIT (u) = p;
-      STACK_USED (u) = SYSTEM_STACK_USED;
-      THREAD_STACK_OFFSET (u) = NO_BYTE;
-      CUR_PTR (&STACK (u)) = A68_SP;
-      CUR_PTR (&FRAME (u)) = A68_FP;
-      INI_PTR (&STACK (u)) = A68_PAR (sp0);
-      INI_PTR (&FRAME (u)) = A68_PAR (fp0);
-      SWAP (&STACK (u)) = NO_BYTE;
-      SWAP (&FRAME (u)) = NO_BYTE;
-      START (&STACK (u)) = NO_BYTE;
-      START (&FRAME (u)) = NO_BYTE;
-      BYTES (&STACK (u)) = 0;
-      BYTES (&FRAME (u)) = 0;
-      ACTIVE (u) = A68_TRUE;
-// Create the thread.
-      errno = 0;
-      if (pthread_attr_init (&new_at) != 0) {
-        diagnostic (A68_RUNTIME_ERROR, p, ERROR_THREAD_FAULT);
-        exit_genie (p, A68_RUNTIME_ERROR);
-      }
-      if (pthread_attr_setstacksize (&new_at, (size_t) A68 (stack_size)) != 0) {
-        diagnostic (A68_RUNTIME_ERROR, p, ERROR_THREAD_FAULT);
-        exit_genie (p, A68_RUNTIME_ERROR);
-      }
-      if (pthread_attr_getstacksize (&new_at, &ss) != 0) {
-        diagnostic (A68_RUNTIME_ERROR, p, ERROR_THREAD_FAULT);
-        exit_genie (p, A68_RUNTIME_ERROR);
-      }
-      ABEND ((size_t) ss != (size_t) A68 (stack_size), ERROR_ACTION, __func__);
-      if (pthread_create (&new_id, &new_at, start_unit, NULL) != 0) {
-        diagnostic (A68_RUNTIME_ERROR, p, ERROR_PARALLEL_CANNOT_CREATE);
-        exit_genie (p, A68_RUNTIME_ERROR);
-      }
-      PARENT (u) = parent;
-      ID (u) = new_id;
-      A68_PAR (context_index)++;
-      save_stacks (new_id);
+      (void) new_context (p, parent);
+      pool_dispatch (p, A68_PAR (context_index) - 1);
     } else {
       start_parallel_units (SUB (p), parent);
     }
   }
 }
 
-//! @brief Execute one unit from a PAR clause.
-
-void *start_genie_parallel (void *arg)
-{
-  pthread_t t;
-  int k;
-  BYTE_T stack_offset;
-  NODE_T *p;
-  BOOL_T units_active;
-  (void) arg;
-  LOCK_THREAD;
-  t = pthread_self ();
-  GET_THREAD_INDEX (k, t);
-  THREAD_STACK_OFFSET (&(A68_PAR (context)[k])) = (BYTE_T *) (&stack_offset - stack_direction (&stack_offset) * STACK_USED (&(A68_PAR (context)[k])));
-  restore_stacks (t);
-  p = (NODE_T *) (UNIT (&(A68_PAR (context)[k])));
-// This is the thread spawned by the main thread, we spawn parallel units and await their completion.
-  start_parallel_units (SUB (p), t);
-  do {
-    units_active = A68_FALSE;
-    check_parallel_units (&units_active, pthread_self ());
-    if (units_active) {
-      try_change_thread (p);
-    }
-  } while (units_active);
-  genie_abend_thread ();
-  return (void *) NULL;
-}
-
 //! @brief Execute parallel clause.
 
 PROP_T genie_parallel (NODE_T * p)
@@ -349,89 +452,45 @@ PROP_T genie_parallel (NODE_T * p)
   ADDR_T stack_s = 0, frame_s = 0;
   BYTE_T *system_stack_offset_s = NO_BYTE;
   if (is_main_thread ()) {
-// Spawn first thread and await its completion.
-    pthread_attr_t new_at;
-    size_t ss;
-    BYTE_T stack_offset;
-    A68_THREAD_CONTEXT *u;
+// Pass the clause to a worker and await completion of all units.
+    BOOL_T units_active;
     LOCK_THREAD;
     A68_PAR (abend_all_threads) = A68_FALSE;
     A68_PAR (exit_from_threads) = A68_FALSE;
     A68_PAR (par_return_code) = 0;
     A68_PAR (sp0) = stack_s = A68_SP;
     A68_PAR (fp0) = frame_s = A68_FP;
+    A68_PAR (stack_owner) = -1;
     system_stack_offset_s = A68 (system_stack_offset);
     A68_PAR (context_index) = 0;
-// Set up a thread for this unit.
-    u = &(A68_PAR (context)[A68_PAR (context_index)]);
-    UNIT (u) = p;
-    STACK_USED (u) = SYSTEM_STACK_USED;
-    THREAD_STACK_OFFSET (u) = NO_BYTE;
-    CUR_PTR (&STACK (u)) = A68_SP;
-    CUR_PTR (&FRAME (u)) = A68_FP;
-    INI_PTR (&STACK (u)) = A68_PAR (sp0);
-    INI_PTR (&FRAME (u)) = A68_PAR (fp0);
-    SWAP (&STACK (u)) = NO_BYTE;
-    SWAP (&FRAME (u)) = NO_BYTE;
-    START (&STACK (u)) = NO_BYTE;
-    START (&FRAME (u)) = NO_BYTE;
-    BYTES (&STACK (u)) = 0;
-    BYTES (&FRAME (u)) = 0;
-    ACTIVE (u) = A68_TRUE;
-// Spawn the first thread and join it to await its completion.
-    errno = 0;
-    if (pthread_attr_init (&new_at) != 0) {
-      diagnostic (A68_RUNTIME_ERROR, p, ERROR_THREAD_FAULT);
-      exit_genie (p, A68_RUNTIME_ERROR);
-    }
-    if (pthread_attr_setstacksize (&new_at, (size_t) A68 (stack_size)) != 0) {
-      diagnostic (A68_RUNTIME_ERROR, p, ERROR_THREAD_FAULT);
-      exit_genie (p, A68_RUNTIME_ERROR);
-    }
-    if (pthread_attr_getstacksize (&new_at, &ss) != 0) {
-      diagnostic (A68_RUNTIME_ERROR, p, ERROR_THREAD_FAULT);
-      exit_genie (p, A68_RUNTIME_ERROR);
-    }
-    ABEND ((size_t) ss != (size_t) A68 (stack_size), ERROR_ACTION, __func__);
-    if (pthread_create (&A68_PAR (parent_thread_id), &new_at, start_genie_parallel, NULL) != 0) {
-      diagnostic (A68_RUNTIME_ERROR, p, ERROR_PARALLEL_CANNOT_CREATE);
-      exit_genie (p, A68_RUNTIME_ERROR);
-    }
-    if (errno != 0) {
-      diagnostic (A68_RUNTIME_ERROR, p, ERROR_THREAD_FAULT);
-      exit_genie (p, A68_RUNTIME_ERROR);
-    }
-    PARENT (u) = A68_PAR (main_thread_id);
-    ID (u) = A68_PAR (parent_thread_id);
-    A68_PAR (context_index)++;
-    save_stacks (A68_PAR (parent_thread_id));
+    (void) new_context (p, A68_PAR (main_thread_id));
+    pool_dispatch (p, 0);
+// Waiting releases the unit_sema.
+    do {
+      units_active = A68_FALSE;
+      for (j = 0; j < A68_PAR (context_index); j++) {
+        units_active |= ACTIVE (&(A68_PAR (context)[j]));
+      }
+      if (units_active) {
+        ABEND (pthread_cond_wait (&A68_PAR (unit_cond), &A68_PAR (unit_sema)) != 0, ERROR_THREAD_FAULT, __func__);
+      }
+    } while (units_active);
     UNLOCK_THREAD;
-    if (pthread_join (A68_PAR (parent_thread_id), NULL) != 0) {
-      diagnostic (A68_RUNTIME_ERROR, p, ERROR_THREAD_FAULT);
-      exit_genie (p, A68_RUNTIME_ERROR);
-    }
-// The first spawned thread has completed, now clean up.
+// All units have completed, now clean up.
     for (j = 0; j < A68_PAR (context_index); j++) {
-      if (ACTIVE (&(A68_PAR (context)[j])) && OTHER_THREAD (ID (&(A68_PAR (context)[j])), A68_PAR (main_thread_id)) && OTHER_THREAD (ID (&(A68_PAR (context)[j])), A68_PAR (parent_thread_id))) {
-// If threads are zapped it is possible that some are active at this point!.
-        if (pthread_join (ID (&(A68_PAR (context)[j])), NULL) != 0) {
-          diagnostic (A68_RUNTIME_ERROR, p, ERROR_THREAD_FAULT);
-          exit_genie (p, A68_RUNTIME_ERROR);
-        }
-      }
       if (SWAP (&STACK (&(A68_PAR (context)[j]))) != NO_BYTE) {
         a68_free (SWAP (&STACK (&(A68_PAR (context)[j]))));
         SWAP (&STACK (&(A68_PAR (context)[j]))) = NO_BYTE;
       }
-      if (SWAP (&STACK (&(A68_PAR (context)[j]))) != NO_BYTE) {
-        a68_free (SWAP (&STACK (&(A68_PAR (context)[j]))));
-        SWAP (&STACK (&(A68_PAR (context)[j]))) = NO_BYTE;
+      if (SWAP (&FRAME (&(A68_PAR (context)[j]))) != NO_BYTE) {
+        a68_free (SWAP (&FRAME (&(A68_PAR (context)[j]))));
+        SWAP (&FRAME (&(A68_PAR (context)[j]))) = NO_BYTE;
       }
     }
-// Now every thread should have ended.
     A68_PAR (context_index) = 0;
     A68_SP = stack_s;
     A68_FP = frame_s;
+    SET_DISPLAY (-1);
     get_stack_size ();
     A68 (system_stack_offset) = system_stack_offset_s;
 // See if we ended execution in parallel clause.
@@ -497,6 +556,7 @@ void genie_up_sema (NODE_T * p)
   POP_REF (p, &s);
   CHECK_INIT (p, INITIALISED (&s), M_SEMA);
   VALUE (DEREF (A68_INT, &s))++;
+  ABEND (pthread_cond_broadcast (&A68_PAR (unit_cond)) != 0, ERROR_THREAD_FAULT, __func__);
 }
 
 //! @brief OP DOWN = (SEMA) VOID
@@ -520,11 +580,8 @@ void genie_down_sema (NODE_T * p)
         if (ERROR_COUNT (&A68_JOB) > 0 || A68_PAR (abend_all_threads)) {
           genie_abend_thread ();
         }
-        UNLOCK_THREAD;
-// Waiting a bit relaxes overhead.
-        int rc = usleep (10);
-        ASSERT (rc == 0 || errno == EINTR);
-        LOCK_THREAD;
+// Await an UP, or the end of a thread.
+        ABEND (pthread_cond_wait (&A68_PAR (unit_cond), &A68_PAR (unit_sema)) != 0, ERROR_THREAD_FAULT, __func__);
 // Garbage may be collected, so recalculate 'k'.
         k = DEREF (A68_INT, &s);
       }
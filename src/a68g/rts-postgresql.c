@@ -47,6 +47,61 @@
 #define NO_PGCONN ((PGconn *) NULL)
 #define NO_PGRESULT ((PGresult *) NULL)
 
+#define HAS_TUPLES(r) (PQresultStatus (r) == PGRES_TUPLES_OK || PQresultStatus (r) == PGRES_SINGLE_TUPLE)
+
+//! @brief Await a result, sending pending output meanwhile.
+
+static void pq_await (PGconn * conn)
+{
+  int flush;
+  while ((flush = PQflush (conn)) == 1 || (flush == 0 && PQisBusy (conn))) {
+    int sock = PQsocket (conn);
+    fd_set in, out;
+    if (sock < 0) {
+      return;
+    }
+    FD_ZERO (&in);
+    FD_ZERO (&out);
+    FD_SET (sock, &in);
+    if (flush == 1) {
+      FD_SET (sock, &out);
+    }
+// Let other parallel units run while the server works.
+#if defined (BUILD_PARALLEL_CLAUSE)
+    release_thread ();
+#endif
+    int rc = select (sock + 1, &in, &out, NULL, NULL);
+#if defined (BUILD_PARALLEL_CLAUSE)
+    resume_thread ();
+#endif
+    if (rc < 0 && errno != EINTR) {
+      return;
+    }
+    if (PQconsumeInput (conn) == 0) {
+      return;
+    }
+  }
+}
+
+//! @brief Execute a query as PQexec does, letting parallel units run while awaiting results.
+
+static PGresult *pq_exec (PGconn * conn, char *query)
+{
+  PGresult *last = NO_PGRESULT, *res;
+  if (PQsendQuery (conn, query) == 0) {
+    return PQmakeEmptyPGresult (conn, PGRES_FATAL_ERROR);
+  }
+  pq_await (conn);
+  while ((res = PQgetResult (conn)) != NO_PGRESULT) {
+    if (last != NO_PGRESULT) {
+      PQclear (last);
+    }
+    last = res;
+    pq_await (conn);
+  }
+  return last;
+}
+
 //! @brief PROC pg connect db (REF FILE, STRING, REF STRING) INT
 
 void genie_pq_connectdb (NODE_T * p)
@@ -163,6 +218,7 @@ void genie_pq_exec (NODE_T * p)
   A68_REF ref_z, query;
   A68_REF ref_file;
   A68_FILE *file;
+  PGresult *res;
   POP_REF (p, &query);
   POP_REF (p, &ref_file);
   CHECK_REF (p, ref_file, M_REF_FILE);
@@ -174,9 +230,13 @@ void genie_pq_exec (NODE_T * p)
   }
   if (RESULT (file) != NO_PGRESULT) {
     PQclear (RESULT (file));
+    RESULT (file) = NO_PGRESULT;
   }
   ref_z = heap_generator (p, M_C_STRING, 1 + a68_string_size (p, query));
-  RESULT (file) = PQexec (CONNECTION (file), a_to_c_string (p, DEREF (char, &ref_z), query));
+  res = pq_exec (CONNECTION (file), a_to_c_string (p, DEREF (char, &ref_z), query));
+// Garbage may be collected while awaiting, so recalculate 'file'.
+  file = FILE_DEREF (&ref_file);
+  RESULT (file) = res;
   if ((PQresultStatus (RESULT (file)) != PGRES_TUPLES_OK)
       && (PQresultStatus (RESULT (file)) != PGRES_COMMAND_OK)) {
     PUSH_PRIMAL (p, -3, INT);
@@ -282,7 +342,7 @@ void genie_pq_ntuples (NODE_T * p)
     PUSH_PRIMAL (p, -2, INT);
     return;
   }
-  PUSH_PRIMAL (p, (PQresultStatus (RESULT (file))) == PGRES_TUPLES_OK ? PQntuples (RESULT (file)) : -3, INT);
+  PUSH_PRIMAL (p, HAS_TUPLES (RESULT (file)) ? PQntuples (RESULT (file)) : -3, INT);
 }
 
 //! @brief PROC pq nfields (REF FILE) INT
@@ -303,7 +363,7 @@ void genie_pq_nfields (NODE_T * p)
     PUSH_PRIMAL (p, -2, INT);
     return;
   }
-  PUSH_PRIMAL (p, (PQresultStatus (RESULT (file))) == PGRES_TUPLES_OK ? PQnfields (RESULT (file)) : -3, INT);
+  PUSH_PRIMAL (p, HAS_TUPLES (RESULT (file)) ? PQnfields (RESULT (file)) : -3, INT);
 }
 
 //! @brief PROC pq fname (REF FILE, INT) INT
@@ -328,7 +388,7 @@ void genie_pq_fname (NODE_T * p)
     PUSH_PRIMAL (p, -2, INT);
     return;
   }
-  upb = (PQresultStatus (RESULT (file)) == PGRES_TUPLES_OK ? PQnfields (RESULT (file)) : 0);
+  upb = (HAS_TUPLES (RESULT (file)) ? PQnfields (RESULT (file)) : 0);
   if (VALUE (&a68_index) < 1 || VALUE (&a68_index) > upb) {
     diagnostic (A68_RUNTIME_ERROR, p, ERROR_INDEX_OUT_OF_BOUNDS);
     exit_genie (p, A68_RUNTIME_ERROR);
@@ -392,7 +452,7 @@ void genie_pq_fformat (NODE_T * p)
     PUSH_PRIMAL (p, -2, INT);
     return;
   }
-  upb = (PQresultStatus (RESULT (file)) == PGRES_TUPLES_OK ? PQnfields (RESULT (file)) : 0);
+  upb = (HAS_TUPLES (RESULT (file)) ? PQnfields (RESULT (file)) : 0);
   if (VALUE (&a68_index) < 1 || VALUE (&a68_index) > upb) {
     diagnostic (A68_RUNTIME_ERROR, p, ERROR_INDEX_OUT_OF_BOUNDS);
     exit_genie (p, A68_RUNTIME_ERROR);
@@ -425,12 +485,12 @@ void genie_pq_getvalue (NODE_T * p)
     PUSH_PRIMAL (p, -2, INT);
     return;
   }
-  upb = (PQresultStatus (RESULT (file)) == PGRES_TUPLES_OK ? PQnfields (RESULT (file)) : 0);
+  upb = (HAS_TUPLES (RESULT (file)) ? PQnfields (RESULT (file)) : 0);
   if (VALUE (&column) < 1 || VALUE (&column) > upb) {
     diagnostic (A68_RUNTIME_ERROR, p, ERROR_INDEX_OUT_OF_BOUNDS);
     exit_genie (p, A68_RUNTIME_ERROR);
   }
-  upb = (PQresultStatus (RESULT (file)) == PGRES_TUPLES_OK ? PQntuples (RESULT (file)) : 0);
+  upb = (HAS_TUPLES (RESULT (file)) ? PQntuples (RESULT (file)) : 0);
   if (VALUE (&row) < 1 || VALUE (&row) > upb) {
     diagnostic (A68_RUNTIME_ERROR, p, ERROR_INDEX_OUT_OF_BOUNDS);
     exit_genie (p, A68_RUNTIME_ERROR);
@@ -473,12 +533,12 @@ void genie_pq_getisnull (NODE_T * p)
     PUSH_PRIMAL (p, -2, INT);
     return;
   }
-  upb = (PQresultStatus (RESULT (file)) == PGRES_TUPLES_OK ? PQnfields (RESULT (file)) : 0);
+  upb = (HAS_TUPLES (RESULT (file)) ? PQnfields (RESULT (file)) : 0);
   if (VALUE (&column) < 1 || VALUE (&column) > upb) {
     diagnostic (A68_RUNTIME_ERROR, p, ERROR_INDEX_OUT_OF_BOUNDS);
     exit_genie (p, A68_RUNTIME_ERROR);
   }
-  upb = (PQresultStatus (RESULT (file)) == PGRES_TUPLES_OK ? PQntuples (RESULT (file)) : 0);
+  upb = (HAS_TUPLES (RESULT (file)) ? PQntuples (RESULT (file)) : 0);
   if (VALUE (&row) < 1 || VALUE (&row) > upb) {
     diagnostic (A68_RUNTIME_ERROR, p, ERROR_INDEX_OUT_OF_BOUNDS);
     exit_genie (p, A68_RUNTIME_ERROR);
@@ -486,6 +546,378 @@ void genie_pq_getisnull (NODE_T * p)
   PUSH_PRIMAL (p, PQgetisnull (RESULT (file), VALUE (&row) - 1, VALUE (&column) - 1), INT);
 }
 
+// Bulk fetch. Reading a result cell by cell with pq getvalue costs a call,
+// bound checks and a STRING per cell. The procedures below convert a whole
+// column, or the whole result, into a row in one call. SQL NULL yields an
+// empty STRING or zero.
+
+//! @brief Query result of "file" that holds tuples, or a runtime error.
+
+static PGresult *pq_tuples (NODE_T * p, A68_REF ref_file)
+{
+  A68_FILE *file;
+  CHECK_REF (p, ref_file, M_REF_FILE);
+  file = FILE_DEREF (&ref_file);
+  CHECK_INIT (p, INITIALISED (file), M_FILE);
+  if (CONNECTION (file) == NO_PGCONN) {
+    diagnostic (A68_RUNTIME_ERROR, p, ERROR_NOT_CONNECTED);
+    exit_genie (p, A68_RUNTIME_ERROR);
+  }
+  if (RESULT (file) == NO_PGRESULT || !HAS_TUPLES (RESULT (file))) {
+    diagnostic (A68_RUNTIME_ERROR, p, ERROR_NO_QUERY_RESULT);
+    exit_genie (p, A68_RUNTIME_ERROR);
+  }
+  return RESULT (file);
+}
+
+//! @brief Pop REF FILE and column number, and return the column index.
+
+static int pq_column (NODE_T * p, PGresult ** res)
+{
+  A68_INT column;
+  A68_REF ref_file;
+  POP_OBJECT (p, &column, A68_INT);
+  CHECK_INIT (p, INITIALISED (&column), M_INT);
+  POP_REF (p, &ref_file);
+  *res = pq_tuples (p, ref_file);
+  if (VALUE (&column) < 1 || VALUE (&column) > PQnfields (*res)) {
+    diagnostic (A68_RUNTIME_ERROR, p, ERROR_INDEX_OUT_OF_BOUNDS);
+    exit_genie (p, A68_RUNTIME_ERROR);
+  }
+  return VALUE (&column) - 1;
+}
+
+//! @brief Convert a column to a row of INT or REAL.
+
+static void pq_get_column (NODE_T * p, MOID_T * row_m, MOID_T * m)
+{
+  A68_REF z, row;
+  A68_ARRAY arr;
+  A68_TUPLE tup;
+  PGresult *res;
+  int col = pq_column (p, &res), n = PQntuples (res);
+  NEW_ROW_1D (z, row, arr, tup, row_m, m, n);
+  BYTE_T *base = DEREF (BYTE_T, &row);
+  for (int k = 0; k < n; k++) {
+    BYTE_T *item = &base[k * SIZE (m)];
+    if (PQgetisnull (res, k, col)) {
+      if (m == M_INT) {
+        VALUE ((A68_INT *) item) = 0;
+      } else {
+        VALUE ((A68_REAL *) item) = 0.0;
+      }
+      STATUS ((A68_INT *) item) = INIT_MASK;
+    } else if (!genie_string_to_value_internal (p, m, PQgetvalue (res, k, col), item)) {
+      diagnostic (A68_RUNTIME_ERROR, p, ERROR_IN_DENOTATION, m);
+      exit_genie (p, A68_RUNTIME_ERROR);
+    }
+  }
+  PUSH_REF (p, z);
+}
+
+//! @brief PROC pq get column = (REF FILE, INT) []STRING
+
+void genie_pq_getcolumn (NODE_T * p)
+{
+  A68_REF z, row;
+  A68_ARRAY arr;
+  A68_TUPLE tup;
+  PGresult *res;
+  int col = pq_column (p, &res), n = PQntuples (res);
+  NEW_ROW_1D (z, row, arr, tup, M_ROW_STRING, M_STRING, n);
+  A68_REF *base = DEREF (A68_REF, &row);
+  for (int k = 0; k < n; k++) {
+    base[k] = c_to_a_string (p, PQgetvalue (res, k, col), DEFAULT_WIDTH);
+  }
+  PUSH_REF (p, z);
+}
+
+//! @brief PROC pq get int column = (REF FILE, INT) []INT
+
+void genie_pq_getintcolumn (NODE_T * p)
+{
+  pq_get_column (p, M_ROW_INT, M_INT);
+}
+
+//! @brief PROC pq get real column = (REF FILE, INT) []REAL
+
+void genie_pq_getrealcolumn (NODE_T * p)
+{
+  pq_get_column (p, M_ROW_REAL, M_REAL);
+}
+
+//! @brief PROC pq get result = (REF FILE) [, ] STRING
+
+void genie_pq_getresult (NODE_T * p)
+{
+  A68_REF ref_file, desc, row;
+  A68_ARRAY arr;
+  A68_TUPLE tup1, tup2;
+  PGresult *res;
+  int n, m;
+  POP_REF (p, &ref_file);
+  res = pq_tuples (p, ref_file);
+  n = PQntuples (res);
+  m = PQnfields (res);
+// Tuples are rows and fields are columns, stored row by row.
+  desc = heap_generator (p, M_ROW_STRING, DESCRIPTOR_SIZE (2));
+  row = heap_generator (p, M_ROW_STRING, n * m * SIZE (M_STRING));
+  DIM (&arr) = 2;
+  MOID (&arr) = M_STRING;
+  ELEM_SIZE (&arr) = SIZE (M_STRING);
+  SLICE_OFFSET (&arr) = FIELD_OFFSET (&arr) = 0;
+  ARRAY (&arr) = row;
+  LWB (&tup1) = 1; UPB (&tup1) = n; SPAN (&tup1) = m;
+  SHIFT (&tup1) = LWB (&tup1) * SPAN (&tup1); K (&tup1) = 0;
+  LWB (&tup2) = 1; UPB (&tup2) = m; SPAN (&tup2) = 1;
+  SHIFT (&tup2) = LWB (&tup2) * SPAN (&tup2); K (&tup2) = 0;
+  PUT_DESCRIPTOR2 (arr, tup1, tup2, &desc);
+  A68_REF *base = DEREF (A68_REF, &row);
+  for (int k = 0; k < n; k++) {
+    for (int j = 0; j < m; j++) {
+      base[k * m + j] = c_to_a_string (p, PQgetvalue (res, k, j), DEFAULT_WIDTH);
+    }
+  }
+  PUSH_REF (p, desc);
+}
+
+// Asynchronous queries. pq send query sends a query without awaiting its
+// result, so a program can compute meanwhile. Results are collected with
+// pq next result, which yields 1 when a query has no more results. In
+// pipeline mode several queries can be in flight on one connection; their
+// results arrive in order, and pq pipeline sync marks a synchronisation
+// point. When a result is awaited inside a parallel clause, other units
+// run until it arrives. Unlike pq exec, pq send query takes a single SQL
+// statement; a string with several statements separated by semicolons is
+// rejected by the server, and pq next result then yields -3.
+
+//! @brief Pop REF FILE and return its connection, or NO_PGCONN.
+
+static PGconn *pq_connection (NODE_T * p, A68_REF * ref_file)
+{
+  A68_FILE *file;
+  POP_REF (p, ref_file);
+  CHECK_REF (p, *ref_file, M_REF_FILE);
+  file = FILE_DEREF (ref_file);
+  CHECK_INIT (p, INITIALISED (file), M_FILE);
+  return CONNECTION (file);
+}
+
+//! @brief Replace the current result of "file" by the next one from the server.
+
+static PGresult *pq_next_result (NODE_T * p, A68_REF ref_file)
+{
+  A68_FILE *file = FILE_DEREF (&ref_file);
+  PGconn *conn = CONNECTION (file);
+  (void) p;
+  if (RESULT (file) != NO_PGRESULT) {
+    PQclear (RESULT (file));
+    RESULT (file) = NO_PGRESULT;
+  }
+  pq_await (conn);
+  PGresult *res = PQgetResult (conn);
+// Garbage may be collected while awaiting, so recalculate 'file'.
+  file = FILE_DEREF (&ref_file);
+  RESULT (file) = res;
+  return res;
+}
+
+//! @brief PROC pq send query = (REF FILE, STRING) INT
+
+void genie_pq_sendquery (NODE_T * p)
+{
+  A68_REF ref_z, query, ref_file;
+  A68_FILE *file;
+  POP_REF (p, &query);
+  PGconn *conn = pq_connection (p, &ref_file);
+  if (conn == NO_PGCONN) {
+    PUSH_PRIMAL (p, -1, INT);
+    return;
+  }
+  file = FILE_DEREF (&ref_file);
+  if (RESULT (file) != NO_PGRESULT) {
+    PQclear (RESULT (file));
+    RESULT (file) = NO_PGRESULT;
+  }
+  ref_z = heap_generator (p, M_C_STRING, 1 + a68_string_size (p, query));
+// PQsendQueryParams rather than PQsendQuery, since only the former is allowed in pipeline mode.
+// It accepts one statement only, whereas PQexec and PQsendQuery accept several.
+  if (PQsendQueryParams (conn, a_to_c_string (p, DEREF (char, &ref_z), query), 0, NULL, NULL, NULL, NULL, 0) == 0) {
+    PUSH_PRIMAL (p, -3, INT);
+  } else {
+    PUSH_PRIMAL (p, 0, INT);
+  }
+}
+
+//! @brief PROC pq next result = (REF FILE) INT
+
+void genie_pq_nextresult (NODE_T * p)
+{
+  A68_REF ref_file;
+  PGresult *res;
+  if (pq_connection (p, &ref_file) == NO_PGCONN) {
+    PUSH_PRIMAL (p, -1, INT);
+    return;
+  }
+  res = pq_next_result (p, ref_file);
+  if (res == NO_PGRESULT) {
+    PUSH_PRIMAL (p, 1, INT);
+  } else {
+    switch (PQresultStatus (res)) {
+    case PGRES_TUPLES_OK:
+    case PGRES_COMMAND_OK:
+    case PGRES_SINGLE_TUPLE:
+    case PGRES_PIPELINE_SYNC:
+      {
+        PUSH_PRIMAL (p, 0, INT);
+        break;
+      }
+    default:
+      {
+        PUSH_PRIMAL (p, -3, INT);
+        break;
+      }
+    }
+  }
+}
+
+//! @brief PROC pq consume input = (REF FILE) INT
+
+void genie_pq_consumeinput (NODE_T * p)
+{
+  A68_REF ref_file;
+  PGconn *conn = pq_connection (p, &ref_file);
+  if (conn == NO_PGCONN) {
+    PUSH_PRIMAL (p, -1, INT);
+  } else {
+    PUSH_PRIMAL (p, (PQconsumeInput (conn) == 1 ? 0 : -3), INT);
+  }
+}
+
+//! @brief PROC pq is busy = (REF FILE) BOOL
+
+void genie_pq_isbusy (NODE_T * p)
+{
+  A68_REF ref_file;
+  PGconn *conn = pq_connection (p, &ref_file);
+  PUSH_VALUE (p, (BOOL_T) (conn != NO_PGCONN && PQisBusy (conn) == 1), A68_BOOL);
+}
+
+//! @brief PROC pq flush = (REF FILE) INT
+
+void genie_pq_flush (NODE_T * p)
+{
+  A68_REF ref_file;
+  PGconn *conn = pq_connection (p, &ref_file);
+  if (conn == NO_PGCONN) {
+    PUSH_PRIMAL (p, -1, INT);
+  } else {
+    int rc = PQflush (conn);
+    PUSH_PRIMAL (p, (rc < 0 ? -3 : rc), INT);
+  }
+}
+
+//! @brief PROC pq set nonblocking = (REF FILE, BOOL) INT
+
+void genie_pq_setnonblocking (NODE_T * p)
+{
+  A68_BOOL z;
+  A68_REF ref_file;
+  POP_OBJECT (p, &z, A68_BOOL);
+  CHECK_INIT (p, INITIALISED (&z), M_BOOL);
+  PGconn *conn = pq_connection (p, &ref_file);
+  if (conn == NO_PGCONN) {
+    PUSH_PRIMAL (p, -1, INT);
+  } else {
+    PUSH_PRIMAL (p, (PQsetnonblocking (conn, VALUE (&z) ? 1 : 0) == 0 ? 0 : -3), INT);
+  }
+}
+
+//! @brief PROC pq enter pipeline mode = (REF FILE) INT
+
+void genie_pq_enterpipelinemode (NODE_T * p)
+{
+  A68_REF ref_file;
+  PGconn *conn = pq_connection (p, &ref_file);
+  if (conn == NO_PGCONN) {
+    PUSH_PRIMAL (p, -1, INT);
+  } else {
+    PUSH_PRIMAL (p, (PQenterPipelineMode (conn) == 1 ? 0 : -3), INT);
+  }
+}
+
+//! @brief PROC pq exit pipeline mode = (REF FILE) INT
+
+void genie_pq_exitpipelinemode (NODE_T * p)
+{
+  A68_REF ref_file;
+  PGconn *conn = pq_connection (p, &ref_file);
+  if (conn == NO_PGCONN) {
+    PUSH_PRIMAL (p, -1, INT);
+  } else {
+    PUSH_PRIMAL (p, (PQexitPipelineMode (conn) == 1 ? 0 : -3), INT);
+  }
+}
+
+//! @brief PROC pq pipeline sync = (REF FILE) INT
+
+void genie_pq_pipelinesync (NODE_T * p)
+{
+  A68_REF ref_file;
+  PGconn *conn = pq_connection (p, &ref_file);
+  if (conn == NO_PGCONN) {
+    PUSH_PRIMAL (p, -1, INT);
+  } else {
+    PUSH_PRIMAL (p, (PQpipelineSync (conn) == 1 ? 0 : -3), INT);
+  }
+}
+
+// Streaming. After pq single row mode, the rows of a query sent with pq send
+// query arrive one by one, so a result need not fit in memory. Each pq get
+// row makes the next row the current result of the FILE, which is then read
+// with pq getvalue or the bulk fetch procedures. After the last row it
+// yields 1 and the query is done. For chunks of rows, fetch from an SQL
+// cursor with pq exec instead.
+
+//! @brief PROC pq single row mode = (REF FILE) INT
+
+void genie_pq_singlerowmode (NODE_T * p)
+{
+  A68_REF ref_file;
+  PGconn *conn = pq_connection (p, &ref_file);
+  if (conn == NO_PGCONN) {
+    PUSH_PRIMAL (p, -1, INT);
+  } else {
+    PUSH_PRIMAL (p, (PQsetSingleRowMode (conn) == 1 ? 0 : -3), INT);
+  }
+}
+
+//! @brief PROC pq get row = (REF FILE) INT
+
+void genie_pq_getrow (NODE_T * p)
+{
+  A68_REF ref_file;
+  PGconn *conn = pq_connection (p, &ref_file);
+  PGresult *res;
+  if (conn == NO_PGCONN) {
+    PUSH_PRIMAL (p, -1, INT);
+    return;
+  }
+  res = pq_next_result (p, ref_file);
+  if (res == NO_PGRESULT) {
+    PUSH_PRIMAL (p, -2, INT);
+  } else if (PQresultStatus (res) == PGRES_SINGLE_TUPLE) {
+    PUSH_PRIMAL (p, 0, INT);
+  } else {
+// Last result of the query; consume the end marker so the connection is free.
+    PGresult *end;
+    while ((end = PQgetResult (conn)) != NO_PGRESULT) {
+      PQclear (end);
+    }
+    PUSH_PRIMAL (p, PQresultStatus (res) == PGRES_TUPLES_OK ? 1 : -3, INT);
+  }
+}
+
 //! @brief Edit error message sting from libpq.
 
 char *pq_edit (char *str)
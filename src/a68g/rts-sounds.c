@@ -31,6 +31,7 @@
 #include "a68g-numbers.h"
 #include "a68g-optimiser.h"
 #include "a68g-double.h"
+#include "a68g-transput.h"
 
 // Implementation of SOUND values.
 
@@ -386,6 +387,7 @@ void read_sound (NODE_T * p, A68_REF ref_file, A68_SOUND * w)
   unt fmt_cat;
   unt blockalign, byterate, chunksize, subchunk2size, z;
   BOOL_T data_read = A68_FALSE;
+  rewind_read_buffer (FD (f), TRANSPUT_BUFFER (f));
   if (read_riff_item (p, FD (f), 4, A68_BIG_ENDIAN) != code_string (p, "RIFF", 4)) {
     diagnostic (A68_RUNTIME_ERROR, p, ERROR_SOUND_INTERNAL, M_SOUND, "file format is not RIFF");
     exit_genie (p, A68_RUNTIME_ERROR);
@@ -503,6 +505,7 @@ void write_sound (NODE_T * p, A68_REF ref_file, A68_SOUND * w)
   unt byterate = SAMPLE_RATE (w) * blockalign;
   unt subchunk2size = NUM_SAMPLES (w) * blockalign;
   unt chunksize = 4 + (8 + 16) + (8 + subchunk2size);
+  flush_write_buffer (TRANSPUT_BUFFER (f));
   write_riff_item (p, FD (f), code_string (p, "RIFF", 4), 4, A68_BIG_ENDIAN);
   write_riff_item (p, FD (f), chunksize, 4, A68_LITTLE_ENDIAN);
   write_riff_item (p, FD (f), code_string (p, "WAVE", 4), 4, A68_BIG_ENDIAN);
@@ -136,6 +136,7 @@ void free_file_entry (NODE_T * p, int k)
 
 void free_file_entries (void)
 {
+  flush_write_buffers ();
   for (int k = 0; k < MAX_OPEN_FILES; k++) {
     free_file_entry (NO_NODE, k);
   }
@@ -189,11 +190,255 @@ char *get_transput_buffer (int n)
   return (char *) (ADDRESS (&ref_transput_buffer[n]) + 2 * SIZE (M_INT));
 }
 
+// Files that are read through a file descriptor have a read-ahead buffer, so
+// that char_scanner and get bin do not issue a read(2) per item.
+// A read-ahead buffer has the same index as the transput buffer of its file.
+// With --mmap, a regular file is mapped instead and scanned in place.
+
+//! @brief Release read-ahead buffer.
+
+void free_read_buffer (int n)
+{
+  READ_BUFFER *rb = &(A68 (read_buffers)[n]);
+  if (MAPPED (rb)) {
+#if defined (HAVE_SYS_MMAN_H)
+    ASSERT (munmap (DATA (rb), SIZE (rb)) == 0);
+#endif
+    MAPPED (rb) = A68_FALSE;
+  } else {
+    a68_free (DATA (rb));
+  }
+  DATA (rb) = NO_TEXT;
+  SIZE (rb) = 0;
+  INDEX (rb) = 0;
+  COUNT (rb) = 0;
+}
+
+//! @brief Discard contents of read-ahead buffer.
+
+void reset_read_buffer (int n)
+{
+  READ_BUFFER *rb = &(A68 (read_buffers)[n]);
+  if (MAPPED (rb)) {
+    free_read_buffer (n);
+  } else {
+    INDEX (rb) = 0;
+    COUNT (rb) = 0;
+  }
+}
+
+//! @brief Number of chars read from the file but not yet scanned.
+
+size_t get_read_buffer_reserve (int n)
+{
+  READ_BUFFER *rb = &(A68 (read_buffers)[n]);
+  return COUNT (rb) - INDEX (rb);
+}
+
+//! @brief Map a regular file that is read from, starting at the current position.
+
+BOOL_T map_read_buffer (FILE_T fd, int n)
+{
+#if defined (HAVE_SYS_MMAN_H)
+  READ_BUFFER *rb = &(A68 (read_buffers)[n]);
+  struct stat status;
+  if (fstat (fd, &status) != 0 || !S_ISREG (ST_MODE (&status)) || status.st_size <= 0) {
+    errno = 0;
+    return A68_FALSE;
+  }
+  __off_t curpos = lseek (fd, 0, SEEK_CUR);
+  if (curpos < 0 || curpos >= status.st_size) {
+    errno = 0;
+    return A68_FALSE;
+  }
+  void *z = mmap (NULL, (size_t) status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (z == MAP_FAILED) {
+    errno = 0;
+    return A68_FALSE;
+  }
+  (void) madvise (z, (size_t) status.st_size, MADV_SEQUENTIAL);
+  MAPPED (rb) = A68_TRUE;
+  DATA (rb) = (char *) z;
+  SIZE (rb) = (size_t) status.st_size;
+  INDEX (rb) = (size_t) curpos;
+  COUNT (rb) = SIZE (rb);
+  return A68_TRUE;
+#else
+  (void) fd;
+  (void) n;
+  return A68_FALSE;
+#endif
+}
+
+//! @brief Refill read-ahead buffer from file, return number of chars available.
+
+size_t fill_read_buffer (FILE_T fd, int n)
+{
+  READ_BUFFER *rb = &(A68 (read_buffers)[n]);
+  if (MAPPED (rb)) {
+// The whole file is mapped, so this is end of file.
+    return 0;
+  }
+  flush_write_buffers ();
+  if (DATA (rb) == NO_TEXT) {
+    if (OPTION_MAP_INPUT (&A68_JOB) && map_read_buffer (fd, n)) {
+      return get_read_buffer_reserve (n);
+    }
+    SIZE (rb) = (size_t) MAX (1, OPTION_READ_BUFFER (&A68_JOB));
+    DATA (rb) = (char *) get_heap_space (SIZE (rb));
+  }
+  reset_read_buffer (n);
+  ssize_t chars_read = io_read_some (fd, DATA (rb), SIZE (rb));
+  if (chars_read > 0) {
+    COUNT (rb) = (size_t) chars_read;
+  }
+  return COUNT (rb);
+}
+
+//! @brief Read n bytes through read-ahead buffer, return number of bytes read.
+
+ssize_t read_buffer_bytes (FILE_T fd, int n, void *z, size_t len)
+{
+  READ_BUFFER *rb = &(A68 (read_buffers)[n]);
+  BYTE_T *u = (BYTE_T *) z;
+  size_t done = 0;
+  while (done < len) {
+    size_t reserve = get_read_buffer_reserve (n);
+    if (reserve == 0 && !MAPPED (rb) && DATA (rb) != NO_TEXT && len - done >= SIZE (rb)) {
+// Large requests bypass the buffer.
+      ssize_t j = io_read (fd, &u[done], len - done);
+      return (j < 0 ? -1 : (ssize_t) done + j);
+    }
+    if (reserve == 0) {
+// An empty fill is end of file, unless the read set errno.
+      errno = 0;
+      if ((reserve = fill_read_buffer (fd, n)) == 0) {
+        return (errno != 0 ? -1 : (ssize_t) done);
+      }
+    }
+    size_t k = MIN (reserve, len - done);
+    memcpy (&u[done], &(DATA (rb)[INDEX (rb)]), k);
+    INDEX (rb) += k;
+    done += k;
+  }
+  return (ssize_t) done;
+}
+
+//! @brief Give back bytes that were read ahead, so the file can be read directly.
+
+void rewind_read_buffer (FILE_T fd, int n)
+{
+  READ_BUFFER *rb = &(A68 (read_buffers)[n]);
+  if (MAPPED (rb)) {
+    (void) lseek (fd, (__off_t) INDEX (rb), SEEK_SET);
+  } else if (get_read_buffer_reserve (n) > 0) {
+    (void) lseek (fd, -(__off_t) get_read_buffer_reserve (n), SEEK_CUR);
+  }
+  reset_read_buffer (n);
+  errno = 0;
+}
+
+// Files that are written through a file descriptor have a write buffer, so
+// that put, print and put bin do not issue a write(2) per item.
+// A write buffer has the same index as the transput buffer of its file.
+// Terminals are line-buffered, other files are written when the buffer is full.
+// Pending output is written before input is read, before a message goes to
+// the terminal, and when the file is closed or the program ends.
+
+//! @brief Write contents of write buffer to its file.
+
+void flush_write_buffer (int n)
+{
+  WRITE_BUFFER *wb = &(A68 (write_buffers)[n]);
+  if (COUNT (wb) > 0) {
+    size_t count = COUNT (wb);
+    COUNT (wb) = 0;
+    errno = 0;
+    ssize_t j = io_write_conv (FD (wb), DATA (wb), count);
+    ABEND (j < 0, ERROR_ACTION, __func__);
+  }
+}
+
+//! @brief Write contents of all write buffers to their files.
+
+void flush_write_buffers (void)
+{
+  for (int k = 0; k < MAX_TRANSPUT_BUFFER; k++) {
+    flush_write_buffer (k);
+  }
+}
+
+//! @brief Flush and release write buffer.
+
+void free_write_buffer (int n)
+{
+  WRITE_BUFFER *wb = &(A68 (write_buffers)[n]);
+  flush_write_buffer (n);
+  a68_free (DATA (wb));
+  DATA (wb) = NO_TEXT;
+  SIZE (wb) = 0;
+}
+
+//! @brief Write n bytes to file through write buffer.
+
+void write_buffer_bytes (FILE_T fd, int n, void *z, size_t len)
+{
+  WRITE_BUFFER *wb = &(A68 (write_buffers)[n]);
+  if (fd == STDERR_FILENO || OPTION_WRITE_BUFFER (&A68_JOB) <= 0) {
+    ssize_t j = io_write (fd, z, len);
+    ABEND (j < 0, ERROR_ACTION, __func__);
+    return;
+  }
+  if (DATA (wb) == NO_TEXT || FD (wb) != fd) {
+    flush_write_buffer (n);
+    if (DATA (wb) == NO_TEXT) {
+      SIZE (wb) = (size_t) OPTION_WRITE_BUFFER (&A68_JOB);
+      DATA (wb) = (char *) get_heap_space (SIZE (wb));
+    }
+    FD (wb) = fd;
+    LINE_BUFFERED (wb) = (BOOL_T) (isatty (fd) != 0);
+    errno = 0;
+  }
+  if (COUNT (wb) + len > SIZE (wb)) {
+    flush_write_buffer (n);
+  }
+  if (len >= SIZE (wb)) {
+    errno = 0;
+    ssize_t j = io_write (fd, z, len);
+    ABEND (j < 0, ERROR_ACTION, __func__);
+  } else {
+    memcpy (&(DATA (wb)[COUNT (wb)]), z, len);
+    COUNT (wb) += len;
+  }
+}
+
+//! @brief Write string to file through write buffer.
+
+void write_buffer_string (FILE_T fd, int n, char *z)
+{
+  if (fd == STDERR_FILENO || OPTION_WRITE_BUFFER (&A68_JOB) <= 0) {
+    WRITE (fd, z);
+    return;
+  }
+  size_t len = strlen (z);
+  write_buffer_bytes (fd, n, z, len);
+  WRITE_BUFFER *wb = &(A68 (write_buffers)[n]);
+  char *nl = strrchr (z, NEWLINE_CHAR);
+  if (fd == STDOUT_FILENO) {
+    A68 (chars_in_tty_line) = (nl == NO_TEXT ? A68 (chars_in_tty_line) + (int) len : (int) strlen (&nl[1]));
+  }
+  if (LINE_BUFFERED (wb) && nl != NO_TEXT) {
+    flush_write_buffer (n);
+  }
+}
+
 //! @brief Mark transput buffer as no longer in use.
 
 void unblock_transput_buffer (int n)
 {
   set_transput_buffer_index (n, -1);
+  free_read_buffer (n);
+  free_write_buffer (n);
 }
 
 //! @brief Find first unused transput buffer (for opening a file).
@@ -202,6 +447,7 @@ int get_unblocked_transput_buffer (NODE_T * p)
 {
   for (int k = FIXED_TRANSPUT_BUFFERS; k < MAX_TRANSPUT_BUFFER; k++) {
     if (get_transput_buffer_index (k) == -1) {
+      reset_read_buffer (k);
       return k;
     }
   }
@@ -224,6 +470,10 @@ void reset_transput_buffer (int n)
 void init_transput_buffers (NODE_T * p)
 {
   for (int k = 0; k < MAX_TRANSPUT_BUFFER; k++) {
+    MAPPED (&(A68 (read_buffers)[k])) = A68_FALSE;
+    DATA (&(A68 (read_buffers)[k])) = NO_TEXT;
+    DATA (&(A68 (write_buffers)[k])) = NO_TEXT;
+    COUNT (&(A68 (write_buffers)[k])) = 0;
     ref_transput_buffer[k] = heap_generator (p, M_ROWS, 2 * SIZE (M_INT) + TRANSPUT_BUFFER_SIZE);
     BLOCK_GC_HANDLE (&ref_transput_buffer[k]);
     set_transput_buffer_size (k, TRANSPUT_BUFFER_SIZE);
@@ -312,14 +562,28 @@ void add_a_string_transput_buffer (NODE_T * p, int k, BYTE_T * ref)
   A68_TUPLE *tup;
   CHECK_INIT (p, INITIALISED (&row), M_ROWS);
   GET_DESCRIPTOR (arr, tup, &row);
-  if (ROW_SIZE (tup) > 0) {
-    BYTE_T *base_address = DEREF (BYTE_T, &ARRAY (arr));
-    for (int i = LWB (tup); i <= UPB (tup); i++) {
-      int addr = INDEX_1_DIM (arr, tup, i);
-      A68_CHAR *ch = (A68_CHAR *) & (base_address[addr]);
-      CHECK_INIT (p, INITIALISED (ch), M_CHAR);
-      plusab_transput_buffer (p, k, (char) VALUE (ch));
+  int len = ROW_SIZE (tup);
+  if (len > 0) {
+// Make room for the whole string at once.
+    int n = get_transput_buffer_index (k), size = get_transput_buffer_size (k);
+    if (n + len > size - 2) {
+      while (n + len > size - 2) {
+        size *= 10;
+      }
+      enlarge_transput_buffer (p, k, size);
     }
+    char *sb = get_transput_buffer (k);
+    BYTE_T *q;
+    int inc;
+    BOOL_T packed = char_sweep (arr, tup, &q, &inc);
+    for (int i = 0; i < len; i++, q += inc) {
+      if (!packed) {
+        CHECK_INIT (p, INITIALISED ((A68_CHAR *) q), M_CHAR);
+      }
+      sb[n++] = (char) CHAR_AT (packed, q);
+    }
+    sb[n] = NULL_CHAR;
+    set_transput_buffer_index (k, n);
   }
 }
 
@@ -359,7 +623,18 @@ void add_c_string_to_a_string (NODE_T * p, A68_REF ref_str, char *s)
   A68_ARRAY *a_1; A68_TUPLE *t_1;
   GET_DESCRIPTOR (a_1, t_1, &a);
   int l_1 = ROW_SIZE (t_1);
-// Sum string.
+// Sum string, in a packed block when the characters fit in a byte.
+  if (packable_chars (a_1, t_1)) {
+    BYTE_T *b_3;
+    A68_REF c = packed_string (p, l_1 + l_2, &b_3);
+    GET_DESCRIPTOR (a_1, t_1, &a);
+    copy_chars (b_3, A68_TRUE, 1, a_1, t_1);
+    for (int v = 0; v < l_2; v++) {
+      b_3[l_1 + v] = (BYTE_T) s[v];
+    }
+    *DEREF (A68_REF, &ref_str) = c;
+    return;
+  }
   A68_REF c = heap_generator (p, M_STRING, DESCRIPTOR_SIZE (1));
   A68_REF d = heap_generator (p, M_STRING, (l_1 + l_2) * SIZE (M_CHAR));
 // Calculate again since garbage collector might have moved data.
@@ -403,7 +678,7 @@ void write_purge_buffer (NODE_T * p, A68_REF ref_file, int k)
   A68_FILE *file = FILE_DEREF (&ref_file);
   if (IS_NIL (STRING (file))) {
     if (!(FD (file) == STDOUT_FILENO && A68 (halt_typing))) {
-      WRITE (FD (file), get_transput_buffer (k));
+      write_buffer_string (FD (file), TRANSPUT_BUFFER (file), get_transput_buffer (k));
     }
   } else {
     add_c_string_to_a_string (p, STRING (file), get_transput_buffer (k));
@@ -1050,6 +1325,7 @@ void genie_lock (NODE_T * p)
   errno = 0;
   ASSERT (fchmod (FD (file), (mode_t) 0x0) != -1);
 #endif
+  flush_write_buffer (TRANSPUT_BUFFER (file));
   if (FD (file) != A68_NO_FILENO && close (FD (file)) == -1) {
     diagnostic (A68_RUNTIME_ERROR, p, ERROR_FILE_LOCK);
     exit_genie (p, A68_RUNTIME_ERROR);
@@ -1082,6 +1358,7 @@ void genie_erase (NODE_T * p)
     return;
   }
 #endif
+  flush_write_buffer (TRANSPUT_BUFFER (file));
   if (FD (file) != A68_NO_FILENO && close (FD (file)) == -1) {
     diagnostic (A68_RUNTIME_ERROR, p, ERROR_FILE_SCRATCH);
     exit_genie (p, A68_RUNTIME_ERROR);
@@ -1114,6 +1391,15 @@ void genie_backspace (NODE_T * p)
   A68_SP = pop_sp;
 }
 
+//! @brief Push a file position as INT.
+
+static void push_file_position (NODE_T * p, __off_t pos)
+{
+// Positions in files past 2 GB do not fit an INT of 32 bits.
+  PRELUDE_ERROR (pos < 0 || (UNSIGNED_T) pos > (UNSIGNED_T) A68_MAX_INT, p, ERROR_OUT_OF_BOUNDS, M_INT);
+  PUSH_VALUE (p, (INT_T) pos, A68_INT);
+}
+
 //! @brief PROC (REF FILE, INT) INT set
 
 void genie_set (NODE_T * p)
@@ -1160,17 +1446,40 @@ void genie_set (NODE_T * p)
   } else if (FD (file) == A68_NO_FILENO) {
     diagnostic (A68_RUNTIME_ERROR, p, ERROR_FILE_RESET);
     exit_genie (p, A68_RUNTIME_ERROR);
+  } else if (MAPPED (&(A68 (read_buffers)[TRANSPUT_BUFFER (file)]))) {
+// A mapped file is set by moving the scan position.
+    READ_BUFFER *rb = &(A68 (read_buffers)[TRANSPUT_BUFFER (file)]);
+    INT_T curpos = (INT_T) INDEX (rb) - get_transput_buffer_index (TRANSPUT_BUFFER (file));
+    reset_transput_buffer (TRANSPUT_BUFFER (file));
+    INDEX (rb) = (size_t) curpos;
+    CHECK_INT_ADDITION (p, curpos, VALUE (&pos));
+    curpos += VALUE (&pos);
+    if (curpos < 0 || curpos >= (INT_T) SIZE (rb)) {
+      A68_BOOL ret;
+      on_event_handler (p, FILE_END_MENDED (FILE_DEREF (&ref_file)), ref_file);
+      POP_OBJECT (p, &ret, A68_BOOL);
+      if (VALUE (&ret) == A68_FALSE) {
+        diagnostic (A68_RUNTIME_ERROR, p, ERROR_FILE_ENDED);
+        exit_genie (p, A68_RUNTIME_ERROR);
+      }
+      push_file_position (p, (__off_t) INDEX (rb));
+    } else {
+      INDEX (rb) = (size_t) curpos;
+      push_file_position (p, (__off_t) curpos);
+    }
   } else {
+    flush_write_buffer (TRANSPUT_BUFFER (file));
     errno = 0;
     __off_t curpos = lseek (FD (file), 0, SEEK_CUR);
     __off_t maxpos = lseek (FD (file), 0, SEEK_END);
     __off_t res = lseek (FD (file), curpos, SEEK_SET);
 // Circumvent buffering problems.
-    int reserve = get_transput_buffer_index (TRANSPUT_BUFFER (file));
+    int reserve = get_transput_buffer_index (TRANSPUT_BUFFER (file)) + (int) get_read_buffer_reserve (TRANSPUT_BUFFER (file));
     curpos -= (__off_t) reserve;
     res = lseek (FD (file), -reserve, SEEK_CUR);
     ASSERT (res != -1 && errno == 0);
     reset_transput_buffer (TRANSPUT_BUFFER (file));
+    reset_read_buffer (TRANSPUT_BUFFER (file));
 // Now set.
     CHECK_INT_ADDITION (p, curpos, VALUE (&pos));
     curpos += VALUE (&pos);
@@ -1182,14 +1491,14 @@ void genie_set (NODE_T * p)
         diagnostic (A68_RUNTIME_ERROR, p, ERROR_FILE_ENDED);
         exit_genie (p, A68_RUNTIME_ERROR);
       }
-      PUSH_VALUE (p, (int) lseek (FD (file), 0, SEEK_CUR), A68_INT);
+      push_file_position (p, lseek (FD (file), 0, SEEK_CUR));
     } else {
       res = lseek (FD (file), curpos, SEEK_SET);
       if (res == -1 || errno != 0) {
         diagnostic (A68_RUNTIME_ERROR, p, ERROR_FILE_SET);
         exit_genie (p, A68_RUNTIME_ERROR);
       }
-      PUSH_VALUE (p, (int) res, A68_INT);
+      push_file_position (p, res);
     }
   }
 }
@@ -1212,7 +1521,9 @@ void genie_reset (NODE_T * p)
     exit_genie (p, A68_RUNTIME_ERROR);
   }
   if (IS_NIL (STRING (file))) {
+    flush_write_buffer (TRANSPUT_BUFFER (file));
     close_file_entry (p, FILE_ENTRY (file));
+    reset_read_buffer (TRANSPUT_BUFFER (file));
   } else {
     STRPOS (file) = 0;
   }
@@ -1445,12 +1756,11 @@ int char_scanner (A68_FILE * f)
     END_OF_FILE (f) = A68_FALSE;
     return pop_char_transput_buffer (TRANSPUT_BUFFER (f));
   } else if (IS_NIL (STRING (f))) {
-// Fetch next CHAR from the FILE.
-    char ch;
-    ssize_t chars_read = io_read_conv (FD (f), &ch, 1);
-    if (chars_read == 1) {
+// Fetch next CHAR from the FILE, through its read-ahead buffer.
+    READ_BUFFER *rb = &(A68 (read_buffers)[TRANSPUT_BUFFER (f)]);
+    if (INDEX (rb) < COUNT (rb) || fill_read_buffer (FD (f), TRANSPUT_BUFFER (f)) > 0) {
       END_OF_FILE (f) = A68_FALSE;
-      return ch;
+      return DATA (rb)[INDEX (rb)++];
     } else {
       END_OF_FILE (f) = A68_TRUE;
       return EOF_CHAR;
@@ -1465,10 +1775,12 @@ int char_scanner (A68_FILE * f)
       END_OF_FILE (f) = A68_TRUE;
       return EOF_CHAR;
     } else {
-      BYTE_T *base = DEREF (BYTE_T, &ARRAY (a));
-      A68_CHAR *ch = (A68_CHAR *) & (base[INDEX_1_DIM (a, t, k)]);
+      A68_REF name = ARRAY (a);
+      OFFSET (&name) += INDEX_1_DIM (a, t, k);
+      BOOL_T packed = PACKED_ROW (&name);
+      BYTE_T *q = (packed ? PACKED_ADDRESS (&name, 0) : ADDRESS (&name));
       STRPOS (f)++;
-      return VALUE (ch);
+      return CHAR_AT (packed, q);
     }
   }
 }
@@ -1477,8 +1789,17 @@ int char_scanner (A68_FILE * f)
 
 void unchar_scanner (NODE_T * p, A68_FILE * f, char ch)
 {
+  READ_BUFFER *rb = &(A68 (read_buffers)[TRANSPUT_BUFFER (f)]);
   END_OF_FILE (f) = A68_FALSE;
-  plusab_transput_buffer (p, TRANSPUT_BUFFER (f), ch);
+  if (IS_NIL (STRING (f)) && INDEX (rb) > 0 && get_transput_buffer_index (TRANSPUT_BUFFER (f)) == 0 && (!MAPPED (rb) || DATA (rb)[INDEX (rb) - 1] == ch)) {
+// Step back in the read-ahead buffer; a mapped file is read-only.
+    INDEX (rb)--;
+    if (!MAPPED (rb)) {
+      DATA (rb)[INDEX (rb)] = ch;
+    }
+  } else {
+    plusab_transput_buffer (p, TRANSPUT_BUFFER (f), ch);
+  }
 }
 
 //! @brief PROC (REF FILE) BOOL eof
@@ -1564,7 +1885,7 @@ void genie_new_line (NODE_T * p)
   if (WRITE_MOOD (file)) {
     on_event_handler (p, LINE_END_MENDED (file), ref_file);
     if (IS_NIL (STRING (file))) {
-      WRITE (FD (file), NEWLINE_STRING);
+      write_buffer_string (FD (file), TRANSPUT_BUFFER (file), NEWLINE_STRING);
     } else {
       add_c_string_to_a_string (p, STRING (file), NEWLINE_STRING);
     }
@@ -1604,7 +1925,7 @@ void genie_new_page (NODE_T * p)
   if (WRITE_MOOD (file)) {
     on_event_handler (p, PAGE_END_MENDED (file), ref_file);
     if (IS_NIL (STRING (file))) {
-      WRITE (FD (file), "\f");
+      write_buffer_string (FD (file), TRANSPUT_BUFFER (file), "\f");
     } else {
       add_c_string_to_a_string (p, STRING (file), "\f");
     }
@@ -1641,7 +1962,7 @@ void genie_space (NODE_T * p)
     exit_genie (p, A68_RUNTIME_ERROR);
   }
   if (WRITE_MOOD (file)) {
-    WRITE (FD (file), " ");
+    write_buffer_string (FD (file), TRANSPUT_BUFFER (file), " ");
   } else if (READ_MOOD (file)) {
     if (!END_OF_FILE (file)) {
       (void) char_scanner (file);
@@ -754,6 +754,7 @@ void genie_read_standard (NODE_T * p, MOID_T * mode, BYTE_T * item, A68_REF ref_
     A68_TUPLE *tup;
     CHECK_INIT (p, INITIALISED ((A68_REF *) item), mode);
     GET_DESCRIPTOR (arr, tup, (A68_REF *) item);
+    UNPACK_ROW (p, arr, tup, (A68_REF *) item);
     if (get_row_size (tup, DIM (arr)) > 0) {
       BYTE_T *base_addr = DEREF (BYTE_T, &ARRAY (arr));
       BOOL_T done = A68_FALSE;
@@ -1096,6 +1097,7 @@ void genie_write_standard (NODE_T * p, MOID_T * mode, BYTE_T * item, A68_REF ref
     A68_TUPLE *tup;
     CHECK_INIT (p, INITIALISED ((A68_REF *) item), M_ROWS);
     GET_DESCRIPTOR (arr, tup, (A68_REF *) item);
+    UNPACK_ROW (p, arr, tup, (A68_REF *) item);
     if (get_row_size (tup, DIM (arr)) > 0) {
       BYTE_T *base_addr = DEREF (BYTE_T, &ARRAY (arr));
       BOOL_T done = A68_FALSE;
@@ -1199,6 +1201,49 @@ void genie_write_file (NODE_T * p)
   }
 }
 
+// Rows of plain values are transput in a sweep over the descriptor,
+// moving the value of each element without dispatching on its mode.
+
+#define BIN_PLAIN(m, t, is_mp)\
+  if (mode == (m)) {\
+    *offset = offsetof (t, value);\
+    *size = sizeof (((t *) NULL)->value);\
+    *mp = (is_mp);\
+    return A68_TRUE;\
+  }
+
+//! @brief Offset and size of the bytes that binary transput moves for a plain mode.
+
+static BOOL_T bin_plain_mode (MOID_T * mode, size_t * offset, size_t * size, BOOL_T * mp)
+{
+  BIN_PLAIN (M_INT, A68_INT, A68_FALSE);
+  BIN_PLAIN (M_REAL, A68_REAL, A68_FALSE);
+  BIN_PLAIN (M_BOOL, A68_BOOL, A68_FALSE);
+  BIN_PLAIN (M_CHAR, A68_CHAR, A68_FALSE);
+  BIN_PLAIN (M_BITS, A68_BITS, A68_FALSE);
+#if (A68_LEVEL >= 3)
+  BIN_PLAIN (M_LONG_INT, A68_LONG_INT, A68_FALSE);
+  BIN_PLAIN (M_LONG_REAL, A68_LONG_REAL, A68_FALSE);
+  BIN_PLAIN (M_LONG_BITS, A68_LONG_BITS, A68_FALSE);
+#else
+  if (mode == M_LONG_INT || mode == M_LONG_REAL || mode == M_LONG_BITS) {
+    *offset = 0;
+    *size = (size_t) SIZE (mode);
+    *mp = A68_TRUE;
+    return A68_TRUE;
+  }
+#endif
+  if (mode == M_LONG_LONG_INT || mode == M_LONG_LONG_REAL || mode == M_LONG_LONG_BITS) {
+    *offset = 0;
+    *size = (size_t) SIZE (mode);
+    *mp = A68_TRUE;
+    return A68_TRUE;
+  }
+  return A68_FALSE;
+}
+
+#undef BIN_PLAIN
+
 //! @brief Read object binary from file.
 
 void genie_read_bin_standard (NODE_T * p, MOID_T * mode, BYTE_T * item, A68_REF ref_file)
@@ -1221,74 +1266,78 @@ void genie_read_bin_standard (NODE_T * p, MOID_T * mode, BYTE_T * item, A68_REF
     genie_read_bin_standard (p, SUB (mode), ADDRESS ((A68_REF *) item), ref_file);
   } else if (mode == M_INT) {
     A68_INT *z = (A68_INT *) item;
-    ASSERT (io_read (FD (f), &(VALUE (z)), sizeof (VALUE (z))) != -1);
+    ASSERT (read_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), &(VALUE (z)), sizeof (VALUE (z))) != -1);
     STATUS (z) = INIT_MASK;
   } else if (mode == M_LONG_INT) {
 #if (A68_LEVEL >= 3)
     A68_LONG_INT *z = (A68_LONG_INT *) item;
-    ASSERT (io_read (FD (f), &(VALUE (z)), sizeof (VALUE (z))) != -1);
+    ASSERT (read_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), &(VALUE (z)), sizeof (VALUE (z))) != -1);
     STATUS (z) = INIT_MASK;
 #else
     MP_T *z = (MP_T *) item;
-    ASSERT (io_read (FD (f), z, (size_t) SIZE (mode)) != -1);
+    ASSERT (read_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), z, (size_t) SIZE (mode)) != -1);
     MP_STATUS (z) = (MP_T) INIT_MASK;
 #endif
   } else if (mode == M_LONG_LONG_INT) {
     MP_T *z = (MP_T *) item;
-    ASSERT (io_read (FD (f), z, (size_t) SIZE (mode)) != -1);
+    ASSERT (read_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), z, (size_t) SIZE (mode)) != -1);
     MP_STATUS (z) = (MP_T) INIT_MASK;
   } else if (mode == M_REAL) {
     A68_REAL *z = (A68_REAL *) item;
-    ASSERT (io_read (FD (f), &(VALUE (z)), sizeof (VALUE (z))) != -1);
+    ASSERT (read_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), &(VALUE (z)), sizeof (VALUE (z))) != -1);
     STATUS (z) = INIT_MASK;
   } else if (mode == M_LONG_REAL) {
 #if (A68_LEVEL >= 3)
     A68_LONG_REAL *z = (A68_LONG_REAL *) item;
-    ASSERT (io_read (FD (f), &(VALUE (z)), sizeof (VALUE (z))) != -1);
+    ASSERT (read_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), &(VALUE (z)), sizeof (VALUE (z))) != -1);
     STATUS (z) = INIT_MASK;
 #else
     MP_T *z = (MP_T *) item;
-    ASSERT (io_read (FD (f), z, (size_t) SIZE (mode)) != -1);
+    ASSERT (read_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), z, (size_t) SIZE (mode)) != -1);
     MP_STATUS (z) = (MP_T) INIT_MASK;
 #endif
   } else if (mode == M_LONG_LONG_REAL) {
     MP_T *z = (MP_T *) item;
-    ASSERT (io_read (FD (f), z, (size_t) SIZE (mode)) != -1);
+    ASSERT (read_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), z, (size_t) SIZE (mode)) != -1);
     MP_STATUS (z) = (MP_T) INIT_MASK;
   } else if (mode == M_BOOL) {
     A68_BOOL *z = (A68_BOOL *) item;
-    ASSERT (io_read (FD (f), &(VALUE (z)), sizeof (VALUE (z))) != -1);
+    ASSERT (read_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), &(VALUE (z)), sizeof (VALUE (z))) != -1);
     STATUS (z) = INIT_MASK;
   } else if (mode == M_CHAR) {
     A68_CHAR *z = (A68_CHAR *) item;
-    ASSERT (io_read (FD (f), &(VALUE (z)), sizeof (VALUE (z))) != -1);
+    ASSERT (read_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), &(VALUE (z)), sizeof (VALUE (z))) != -1);
     STATUS (z) = INIT_MASK;
   } else if (mode == M_BITS) {
     A68_BITS *z = (A68_BITS *) item;
-    ASSERT (io_read (FD (f), &(VALUE (z)), sizeof (VALUE (z))) != -1);
+    ASSERT (read_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), &(VALUE (z)), sizeof (VALUE (z))) != -1);
     STATUS (z) = INIT_MASK;
   } else if (mode == M_LONG_BITS) {
 #if (A68_LEVEL >= 3)
     A68_LONG_BITS *z = (A68_LONG_BITS *) item;
-    ASSERT (io_read (FD (f), &(VALUE (z)), sizeof (VALUE (z))) != -1);
+    ASSERT (read_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), &(VALUE (z)), sizeof (VALUE (z))) != -1);
     STATUS (z) = INIT_MASK;
 #else
     MP_T *z = (MP_T *) item;
-    ASSERT (io_read (FD (f), z, (size_t) SIZE (mode)) != -1);
+    ASSERT (read_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), z, (size_t) SIZE (mode)) != -1);
     MP_STATUS (z) = (MP_T) INIT_MASK;
 #endif
   } else if (mode == M_LONG_LONG_BITS) {
     MP_T *z = (MP_T *) item;
-    ASSERT (io_read (FD (f), z, (size_t) SIZE (mode)) != -1);
+    ASSERT (read_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), z, (size_t) SIZE (mode)) != -1);
     MP_STATUS (z) = (MP_T) INIT_MASK;
   } else if (mode == M_ROW_CHAR || mode == M_STRING) {
-    int len, k;
-    ASSERT (io_read (FD (f), &(len), sizeof (len)) != -1);
+    int len;
+    ASSERT (read_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), &(len), sizeof (len)) != -1);
     reset_transput_buffer (UNFORMATTED_BUFFER);
-    for (k = 0; k < len; k++) {
-      char ch;
-      ASSERT (io_read (FD (f), &(ch), sizeof (char)) != -1);
-      plusab_transput_buffer (p, UNFORMATTED_BUFFER, ch);
+    if (len > 0) {
+      if (len >= get_transput_buffer_size (UNFORMATTED_BUFFER)) {
+        enlarge_transput_buffer (p, UNFORMATTED_BUFFER, len + 1);
+      }
+      char *sb = get_transput_buffer (UNFORMATTED_BUFFER);
+      ssize_t k = read_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), sb, (size_t) len);
+      ASSERT (k != -1);
+      sb[k] = NULL_CHAR;
     }
     *(A68_REF *) item = c_to_a_string (p, get_transput_buffer (UNFORMATTED_BUFFER), DEFAULT_WIDTH);
   } else if (IS_UNION (mode)) {
@@ -1308,14 +1357,27 @@ void genie_read_bin_standard (NODE_T * p, MOID_T * mode, BYTE_T * item, A68_REF
     A68_ARRAY *arr; A68_TUPLE *tup;
     CHECK_INIT (p, INITIALISED ((A68_REF *) item), M_ROWS);
     GET_DESCRIPTOR (arr, tup, (A68_REF *) item);
+    UNPACK_ROW (p, arr, tup, (A68_REF *) item);
     if (get_row_size (tup, DIM (arr)) > 0) {
       BYTE_T *base_addr = DEREF (BYTE_T, &ARRAY (arr));
+      size_t offset, size;
+      BOOL_T mp, plain = bin_plain_mode (SUB (deflexed), &offset, &size, &mp);
       BOOL_T done = A68_FALSE;
       initialise_internal_index (tup, DIM (arr));
       while (!done) {
         ADDR_T a68_index = calculate_internal_index (tup, DIM (arr));
         ADDR_T elem_addr = ROW_ELEMENT (arr, a68_index);
-        genie_read_bin_standard (p, SUB (deflexed), &base_addr[elem_addr], ref_file);
+        BYTE_T *elem = &base_addr[elem_addr];
+        if (plain) {
+          ASSERT (read_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), &elem[offset], size) != -1);
+          if (mp) {
+            MP_STATUS ((MP_T *) elem) = (MP_T) INIT_MASK;
+          } else {
+            STATUS ((A68_INT *) elem) = INIT_MASK;
+          }
+        } else {
+          genie_read_bin_standard (p, SUB (deflexed), elem, ref_file);
+        }
         done = increment_internal_index (tup, DIM (arr));
       }
     }
@@ -1414,45 +1476,45 @@ void genie_write_bin_standard (NODE_T * p, MOID_T * mode, BYTE_T * item, A68_REF
   } else if (mode == M_SOUND) {
     write_sound (p, ref_file, (A68_SOUND *) item);
   } else if (mode == M_INT) {
-    ASSERT (io_write (FD (f), &(VALUE ((A68_INT *) item)), sizeof (VALUE ((A68_INT *) item))) != -1);
+    write_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), &(VALUE ((A68_INT *) item)), sizeof (VALUE ((A68_INT *) item)));
   } else if (mode == M_LONG_INT) {
 #if (A68_LEVEL >= 3)
-    ASSERT (io_write (FD (f), &(VALUE ((A68_LONG_INT *) item)), sizeof (VALUE ((A68_LONG_INT *) item))) != -1);
+    write_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), &(VALUE ((A68_LONG_INT *) item)), sizeof (VALUE ((A68_LONG_INT *) item)));
 #else
-    ASSERT (io_write (FD (f), (MP_T *) item, (size_t) SIZE (mode)) != -1);
+    write_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), (MP_T *) item, (size_t) SIZE (mode));
 #endif
   } else if (mode == M_LONG_LONG_INT) {
-    ASSERT (io_write (FD (f), (MP_T *) item, (size_t) SIZE (mode)) != -1);
+    write_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), (MP_T *) item, (size_t) SIZE (mode));
   } else if (mode == M_REAL) {
-    ASSERT (io_write (FD (f), &(VALUE ((A68_REAL *) item)), sizeof (VALUE ((A68_REAL *) item))) != -1);
+    write_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), &(VALUE ((A68_REAL *) item)), sizeof (VALUE ((A68_REAL *) item)));
   } else if (mode == M_LONG_REAL) {
 #if (A68_LEVEL >= 3)
-    ASSERT (io_write (FD (f), &(VALUE ((A68_LONG_REAL *) item)), sizeof (VALUE ((A68_LONG_REAL *) item))) != -1);
+    write_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), &(VALUE ((A68_LONG_REAL *) item)), sizeof (VALUE ((A68_LONG_REAL *) item)));
 #else
-    ASSERT (io_write (FD (f), (MP_T *) item, (size_t) SIZE (mode)) != -1);
+    write_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), (MP_T *) item, (size_t) SIZE (mode));
 #endif
   } else if (mode == M_LONG_LONG_REAL) {
-    ASSERT (io_write (FD (f), (MP_T *) item, (size_t) SIZE (mode)) != -1);
+    write_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), (MP_T *) item, (size_t) SIZE (mode));
   } else if (mode == M_BOOL) {
-    ASSERT (io_write (FD (f), &(VALUE ((A68_BOOL *) item)), sizeof (VALUE ((A68_BOOL *) item))) != -1);
+    write_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), &(VALUE ((A68_BOOL *) item)), sizeof (VALUE ((A68_BOOL *) item)));
   } else if (mode == M_CHAR) {
-    ASSERT (io_write (FD (f), &(VALUE ((A68_CHAR *) item)), sizeof (VALUE ((A68_CHAR *) item))) != -1);
+    write_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), &(VALUE ((A68_CHAR *) item)), sizeof (VALUE ((A68_CHAR *) item)));
   } else if (mode == M_BITS) {
-    ASSERT (io_write (FD (f), &(VALUE ((A68_BITS *) item)), sizeof (VALUE ((A68_BITS *) item))) != -1);
+    write_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), &(VALUE ((A68_BITS *) item)), sizeof (VALUE ((A68_BITS *) item)));
   } else if (mode == M_LONG_BITS) {
 #if (A68_LEVEL >= 3)
-    ASSERT (io_write (FD (f), &(VALUE ((A68_LONG_BITS *) item)), sizeof (VALUE ((A68_LONG_BITS *) item))) != -1);
+    write_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), &(VALUE ((A68_LONG_BITS *) item)), sizeof (VALUE ((A68_LONG_BITS *) item)));
 #else
-    ASSERT (io_write (FD (f), (MP_T *) item, (size_t) SIZE (mode)) != -1);
+    write_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), (MP_T *) item, (size_t) SIZE (mode));
 #endif
   } else if (mode == M_LONG_LONG_BITS) {
-    ASSERT (io_write (FD (f), (MP_T *) item, (size_t) SIZE (mode)) != -1);
+    write_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), (MP_T *) item, (size_t) SIZE (mode));
   } else if (mode == M_ROW_CHAR || mode == M_STRING) {
     reset_transput_buffer (UNFORMATTED_BUFFER);
     add_a_string_transput_buffer (p, UNFORMATTED_BUFFER, item);
     int len = get_transput_buffer_index (UNFORMATTED_BUFFER);
-    ASSERT (io_write (FD (f), &(len), sizeof (len)) != -1);
-    WRITE (FD (f), get_transput_buffer (UNFORMATTED_BUFFER));
+    write_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), &(len), sizeof (len));
+    write_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), get_transput_buffer (UNFORMATTED_BUFFER), (size_t) len);
   } else if (IS_UNION (mode)) {
     A68_UNION *z = (A68_UNION *) item;
     genie_write_bin_standard (p, (MOID_T *) (VALUE (z)), &item[A68_UNION_SIZE], ref_file);
@@ -1468,8 +1530,11 @@ void genie_write_bin_standard (NODE_T * p, MOID_T * mode, BYTE_T * item, A68_REF
     A68_ARRAY *arr; A68_TUPLE *tup;
     CHECK_INIT (p, INITIALISED ((A68_REF *) item), M_ROWS);
     GET_DESCRIPTOR (arr, tup, (A68_REF *) item);
+    UNPACK_ROW (p, arr, tup, (A68_REF *) item);
     if (get_row_size (tup, DIM (arr)) > 0) {
       BYTE_T *base_addr = DEREF (BYTE_T, &ARRAY (arr));
+      size_t offset, size;
+      BOOL_T mp, plain = bin_plain_mode (SUB (deflexed), &offset, &size, &mp);
       BOOL_T done = A68_FALSE;
       initialise_internal_index (tup, DIM (arr));
       while (!done) {
@@ -1477,7 +1542,11 @@ void genie_write_bin_standard (NODE_T * p, MOID_T * mode, BYTE_T * item, A68_REF
         ADDR_T elem_addr = ROW_ELEMENT (arr, a68_index);
         BYTE_T *elem = &base_addr[elem_addr];
         genie_check_initialisation (p, elem, SUB (deflexed));
-        genie_write_bin_standard (p, SUB (deflexed), elem, ref_file);
+        if (plain) {
+          write_buffer_bytes (FD (f), TRANSPUT_BUFFER (f), &elem[offset], size);
+        } else {
+          genie_write_bin_standard (p, SUB (deflexed), elem, ref_file);
+        }
         done = increment_internal_index (tup, DIM (arr));
       }
     }
@@ -2022,12 +2091,323 @@ char *sub_fixed_double (NODE_T * p, DOUBLE_T x, int width, int after, int precis
   return str;
 }
 
+// Exact decimal digits for REAL.
+// A finite REAL equals m * 2 ^ e for integers m and e, so |x| * 10 ^ k is
+// the fraction m * 5 ^ k * 2 ^ (e + k) and can be rounded with integer
+// arithmetic. Digits therefore are those of the binary value itself; the
+// former method scaled in DOUBLE precision and could be off in the last
+// digit, for instance at a tie like fixed (0.125, 0, 2).
+
+#define REAL_LIMBS 48
+
+typedef struct REAL_BIG_T REAL_BIG_T;
+
+struct REAL_BIG_T
+{
+  int size;
+  unt limb[REAL_LIMBS];
+};
+
+#define LIMB(z) ((z)->limb)
+
+static void big_set (REAL_BIG_T * z, UNSIGNED_T v)
+{
+  LIMB (z)[0] = (unt) v;
+  LIMB (z)[1] = (unt) (v >> 32);
+  SIZE (z) = (LIMB (z)[1] != 0 ? 2 : (LIMB (z)[0] != 0 ? 1 : 0));
+}
+
+static int big_bits (REAL_BIG_T * z)
+{
+  if (SIZE (z) == 0) {
+    return 0;
+  }
+  int n = 32 * (SIZE (z) - 1);
+  for (unt top = LIMB (z)[SIZE (z) - 1]; top != 0; top >>= 1) {
+    n++;
+  }
+  return n;
+}
+
+static void big_mul (REAL_BIG_T * z, unt k)
+{
+  UNSIGNED_T carry = 0;
+  for (int j = 0; j < SIZE (z); j++) {
+    carry += (UNSIGNED_T) LIMB (z)[j] * k;
+    LIMB (z)[j] = (unt) carry;
+    carry >>= 32;
+  }
+  if (carry != 0) {
+    ABEND (SIZE (z) >= REAL_LIMBS, ERROR_INTERNAL_CONSISTENCY, __func__);
+    LIMB (z)[SIZE (z)++] = (unt) carry;
+  }
+}
+
+static void big_pow5 (REAL_BIG_T * z, int n)
+{
+  for (; n >= 13; n -= 13) {
+    big_mul (z, 1220703125);
+  }
+  unt k = 1;
+  for (; n > 0; n--) {
+    k *= 5;
+  }
+  big_mul (z, k);
+}
+
+static void big_shl (REAL_BIG_T * z, int n)
+{
+  if (SIZE (z) == 0 || n == 0) {
+    return;
+  }
+  int w = n / 32, b = n % 32;
+  ABEND (SIZE (z) + w + 1 > REAL_LIMBS, ERROR_INTERNAL_CONSISTENCY, __func__);
+  LIMB (z)[SIZE (z) + w] = 0;
+  for (int j = SIZE (z) - 1; j >= 0; j--) {
+    UNSIGNED_T u = (UNSIGNED_T) LIMB (z)[j] << b;
+    LIMB (z)[j + w + 1] |= (unt) (u >> 32);
+    LIMB (z)[j + w] = (unt) u;
+  }
+  for (int j = 0; j < w; j++) {
+    LIMB (z)[j] = 0;
+  }
+  SIZE (z) += w + 1;
+  while (SIZE (z) > 0 && LIMB (z)[SIZE (z) - 1] == 0) {
+    SIZE (z)--;
+  }
+}
+
+static void big_shr1 (REAL_BIG_T * z)
+{
+  for (int j = 0; j < SIZE (z); j++) {
+    LIMB (z)[j] = (LIMB (z)[j] >> 1) | (j + 1 < SIZE (z) ? LIMB (z)[j + 1] << 31 : 0);
+  }
+  while (SIZE (z) > 0 && LIMB (z)[SIZE (z) - 1] == 0) {
+    SIZE (z)--;
+  }
+}
+
+static int big_cmp (REAL_BIG_T * u, REAL_BIG_T * v)
+{
+  if (SIZE (u) != SIZE (v)) {
+    return SIZE (u) < SIZE (v) ? -1 : 1;
+  }
+  for (int j = SIZE (u) - 1; j >= 0; j--) {
+    if (LIMB (u)[j] != LIMB (v)[j]) {
+      return LIMB (u)[j] < LIMB (v)[j] ? -1 : 1;
+    }
+  }
+  return 0;
+}
+
+static void big_sub (REAL_BIG_T * u, REAL_BIG_T * v)
+{
+// Assuming u >= v.
+  INT_T borrow = 0;
+  for (int j = 0; j < SIZE (u); j++) {
+    INT_T w = (INT_T) LIMB (u)[j] - (j < SIZE (v) ? LIMB (v)[j] : 0) - borrow;
+    borrow = (w < 0);
+    LIMB (u)[j] = (unt) w;
+  }
+  while (SIZE (u) > 0 && LIMB (u)[SIZE (u) - 1] == 0) {
+    SIZE (u)--;
+  }
+}
+
+//! @brief floor (|x| * 10 ^ k + 1 / (2 * 10 ^ s)), or floor (|x| * 10 ^ k) when s < 0.
+
+static UNSIGNED_T scale_real (REAL_T x, int k, int s)
+{
+  int e;
+  UNSIGNED_T m = (UNSIGNED_T) ldexp (frexp (ABS (x), &e), DBL_MANT_DIG);
+  e -= DBL_MANT_DIG;
+  if (m == 0) {
+    return 0;
+  }
+  while ((m & 1) == 0) {
+    m >>= 1;
+    e++;
+  }
+// |x| * 10 ^ k = u / v.
+  REAL_BIG_T u, v;
+  big_set (&u, m);
+  big_set (&v, 1);
+  if (k >= 0) {
+    big_pow5 (&u, k);
+  } else {
+    big_pow5 (&v, -k);
+  }
+  if (e + k >= 0) {
+    big_shl (&u, e + k);
+  } else {
+    big_shl (&v, -(e + k));
+  }
+// Binary long division, callers keep the quotient below 2 ^ 64.
+  UNSIGNED_T d = 0;
+  int shift = big_bits (&u) - big_bits (&v);
+  if (shift >= 0) {
+    ABEND (shift >= 64, ERROR_INTERNAL_CONSISTENCY, __func__);
+    big_shl (&v, shift);
+    for (int j = shift; j >= 0; j--) {
+      if (big_cmp (&u, &v) >= 0) {
+        big_sub (&u, &v);
+        d |= (UNSIGNED_T) 1 << j;
+      }
+      if (j > 0) {
+        big_shr1 (&v);
+      }
+    }
+  }
+// Now u is the remainder; the half rounds up iff 2 * 10 ^ s * (v - u) <= v.
+  if (s >= 0) {
+    REAL_BIG_T g = v;
+    big_sub (&g, &u);
+    big_mul (&g, 2);
+    int bits = big_bits (&v);
+    for (int j = s; j > 0 && big_bits (&g) <= bits; j -= 9) {
+      unt k10 = 1;
+      for (int i = 0; i < MIN (j, 9); i++) {
+        k10 *= 10;
+      }
+      big_mul (&g, k10);
+    }
+    if (big_cmp (&g, &v) <= 0) {
+      d++;
+    }
+  }
+  return d;
+}
+
+//! @brief Decimal exponent of REAL, that is floor (log10 (|x|)), exactly.
+
+static int exponent_real (REAL_T x)
+{
+// Assuming x != 0.
+  int e = (int) floor (log10 (ABS (x)));
+// The estimate holds unless x is close to a power of ten.
+  if (ABS (e) < 300) {
+    REAL_T r = ABS (x) / ten_up (e);
+    if (r > 1.000001 && r < 9.99999) {
+      return e;
+    }
+  }
+  UNSIGNED_T d;
+  while ((d = scale_real (x, -e, -1)) == 0) {
+    e--;
+  }
+  while (d >= 10) {
+    e++;
+    d = scale_real (x, -e, -1);
+  }
+  return e;
+}
+
+//! @brief Round |x| / 10 ^ q to "after" decimals.
+
+static void decimal_real (REAL_T x, int q, int after, int *before, int *zeros, UNSIGNED_T * d)
+{
+// The rounded value has "before" integral digits. As before, positions
+// beyond REAL_WIDTH print as '0'; "d" holds the leading positions.
+  *before = 0;
+  *zeros = MAX (0, after - REAL_WIDTH);
+  *d = 0;
+  if (x == 0) {
+    return;
+  }
+// Estimate the integral digits, then correct the estimate.
+  int est = (int) floor (log10 (ABS (x))) - q + 1;
+  while (A68_TRUE) {
+    *before = MAX (0, est);
+    *zeros = MAX (0, *before + after - REAL_WIDTH);
+    *d = scale_real (x, after - q - *zeros, *zeros);
+    int n = 0;
+    for (UNSIGNED_T t = *d; t > 0; t /= 10) {
+      n++;
+    }
+    est = (*d == 0 ? 0 : n + *zeros - after);
+    if (MAX (0, est) == *before) {
+      return;
+    }
+  }
+}
+
+//! @brief Compose digits from "decimal_real".
+
+static char *compose_real (NODE_T * p, int before, int after, int zeros, UNSIGNED_T d, int width)
+{
+  int len = before + after, k = 0;
+  char *str = stack_string (p, 8 + len);
+  for (int j = 0; j < len; j++) {
+    if (j == before) {
+      str[k++] = POINT_CHAR;
+    }
+    str[k++] = '0';
+  }
+  for (int j = len - zeros - 1; j >= 0; j--) {
+    str[j < before ? j : j + 1] = digchar ((int) (d % 10));
+    d /= 10;
+  }
+  if (k > width) {
+    (void) error_chars (str, width);
+  }
+  return str;
+}
+
+//! @brief Standard string for REAL x / 10 ^ q.
+
+char *sub_fixed_real (NODE_T * p, REAL_T x, int q, int width, int after)
+{
+  ABEND (x < 0, ERROR_INTERNAL_CONSISTENCY, __func__);
+  int before, zeros;
+  UNSIGNED_T d;
+  decimal_real (x, q, after, &before, &zeros, &d);
+  return compose_real (p, before, after, zeros, d, width);
+}
+
 //! @brief Standard string for REAL.
 
 char *sub_fixed (NODE_T * p, REAL_T x, int width, int after)
 {
-// Better precision than the REAL only routine
-  return sub_fixed_double (p, (DOUBLE_T) x, width, after, REAL_WIDTH);
+  return sub_fixed_real (p, x, 0, width, after);
+}
+
+//! @brief Formatted string for REAL x / 10 ^ q.
+
+static char *fixed_real (NODE_T * p, REAL_T x, int q, int width, int after)
+{
+  ADDR_T pop_sp = A68_SP;
+  int length = ABS (width) - (x < 0 || width > 0 ? 1 : 0);
+  if (after >= 0 && (length > after || width == 0)) {
+    int before, zeros;
+    UNSIGNED_T d;
+    decimal_real (x, q, after, &before, &zeros, &d);
+    if (width == 0) {
+      length = MAX (before, after == 0 ? 1 : 0) + (after == 0 ? 0 : after + 1);
+    }
+    char *s = compose_real (p, before, after, zeros, d, length);
+    if (strchr (s, ERROR_CHAR) == NO_TEXT) {
+      if (length > (int) strlen (s) && before == 0) {
+        (void) plusto ('0', s);
+      }
+      if (x < 0) {
+        (void) plusto ('-', s);
+      } else if (width > 0) {
+        (void) plusto ('+', s);
+      }
+      if (width != 0) {
+        (void) leading_spaces (s, ABS (width));
+      }
+      return s;
+    } else if (after > 0) {
+      A68_SP = pop_sp;
+      return fixed_real (p, x, q, width, after - 1);
+    } else {
+      return error_chars (s, width);
+    }
+  } else {
+    char *s = stack_string (p, 8 + ABS (width));
+    return error_chars (s, width);
+  }
 }
 
 #else
@@ -2107,6 +2487,14 @@ char *fixed (NODE_T * p)
   DECREMENT_STACK_POINTER (p, SIZE (M_NUMBER));
   MOID_T *mode = (MOID_T *) (VALUE ((A68_UNION *) STACK_TOP));
   ADDR_T pop_sp = A68_SP;
+#if (A68_LEVEL >= 3)
+  if (mode == M_REAL) {
+    REAL_T x = VALUE ((A68_REAL *) (STACK_OFFSET (A68_UNION_SIZE)));
+    CHECK_REAL (p, x);
+    A68_SP = arg_sp;
+    return fixed_real (p, x, 0, VALUE (&width), VALUE (&after));
+  }
+#endif
   if (mode == M_REAL) {
     REAL_T x = VALUE ((A68_REAL *) (STACK_OFFSET (A68_UNION_SIZE)));
     int length = ABS (VALUE (&width)) - (x < 0 || VALUE (&width) > 0 ? 1 : 0);
@@ -2248,7 +2636,7 @@ char *fixed (NODE_T * p)
     }
   }
   if (mode == M_INT) {
-    int x = VALUE ((A68_INT *) (STACK_OFFSET (A68_UNION_SIZE)));
+    INT_T x = VALUE ((A68_INT *) (STACK_OFFSET (A68_UNION_SIZE)));
     PUSH_UNION (p, M_REAL);
     PUSH_VALUE (p, (REAL_T) x, A68_REAL);
     INCREMENT_STACK_POINTER (p, SIZE (M_NUMBER) - (A68_UNION_SIZE + SIZE (M_REAL)));
@@ -2349,6 +2737,32 @@ void standardise (REAL_T * y, int before, int after, int *p)
   *y = (REAL_T) z;
 }
 
+//! @brief Exponent q so that x / 10 ^ q has "before" integral digits when rounded to "after" decimals.
+
+void standardise_real (REAL_T x, int before, int after, int *q)
+{
+// Unlike "standardise", x is not scaled, since that would round.
+  *q = 0;
+  if (x == 0) {
+    return;
+  }
+  int e = exponent_real (x);
+  *q = e - before + 1;
+// Rounding may carry into a new digit, as 9.99 into 10.0, when there are
+// few digits or x is close to the next power of ten.
+  if (before + after > 6 && ABS (e) < 300 && ABS (x) / ten_up (e) < 9.99999) {
+    return;
+  }
+  int zeros = MAX (0, before + after - REAL_WIDTH);
+  UNSIGNED_T g = 1;
+  for (int j = zeros; j < before + after; j++) {
+    g *= 10;
+  }
+  if (scale_real (x, after - *q - zeros, zeros) >= g) {
+    (*q)++;
+  }
+}
+
 #else
 
 //! @brief Scale REAL for formatting.
@@ -2399,6 +2813,72 @@ char *real (NODE_T * p)
   DECREMENT_STACK_POINTER (p, SIZE (M_NUMBER));
   MOID_T *mode = (MOID_T *) (VALUE ((A68_UNION *) STACK_TOP));
   ADDR_T pop_sp = A68_SP;
+#if (A68_LEVEL >= 3)
+  if (mode == M_REAL) {
+    REAL_T x = VALUE ((A68_REAL *) (STACK_OFFSET (A68_UNION_SIZE)));
+    int before = ABS (VALUE (&width)) - ABS (VALUE (&expo)) - (VALUE (&after) != 0 ? VALUE (&after) + 1 : 0) - 2;
+    A68_SP = arg_sp;
+    CHECK_REAL (p, x);
+    if (SIGN (before) + SIGN (VALUE (&after)) > 0) {
+// The mantissa is x / 10 ^ q, which is formatted without scaling x.
+      int q;
+      standardise_real (x, before, VALUE (&after), &q);
+      if (VALUE (&frmt) > 0) {
+        while (q % VALUE (&frmt) != 0) {
+          q--;
+          if (VALUE (&after) > 0) {
+            VALUE (&after)--;
+          }
+        }
+      } else if (x != 0) {
+// Compare x / 10 ^ q to powers of ten through the exponent of x
+// rounded to REAL_WIDTH digits, as it will print.
+        int e = exponent_real (x), lwb = -VALUE (&frmt) - 1, upb = -VALUE (&frmt);
+        UNSIGNED_T d = scale_real (x, REAL_WIDTH - 1 - e, 0), h = (UNSIGNED_T) ten_up (REAL_WIDTH - 1);
+        if (d == 10 * h) {
+          e++;
+          d = h;
+        }
+        while (e - q < lwb) {
+          q--;
+          if (VALUE (&after) > 0) {
+            VALUE (&after)--;
+          }
+        }
+        while (e - q > upb || (e - q == upb && d != h)) {
+          q++;
+          if (VALUE (&after) > 0) {
+            VALUE (&after)++;
+          }
+        }
+      }
+      char *t1 = fixed_real (p, x, q, SIGN (VALUE (&width)) * (ABS (VALUE (&width)) - ABS (VALUE (&expo)) - 1), VALUE (&after));
+      PUSH_UNION (p, M_INT);
+      PUSH_VALUE (p, q, A68_INT);
+      INCREMENT_STACK_POINTER (p, SIZE (M_NUMBER) - (A68_UNION_SIZE + SIZE (M_INT)));
+      PUSH_VALUE (p, VALUE (&expo), A68_INT);
+      char *t2 = whole (p);
+      int strwid = 8 + (int) strlen (t1) + 1 + (int) strlen (t2);
+      char *s = stack_string (p, strwid);
+      bufcpy (s, t1, strwid);
+      (void) string_plusab_char (s, EXPONENT_CHAR, strwid);
+      bufcat (s, t2, strwid);
+      if (VALUE (&expo) == 0 || strchr (s, ERROR_CHAR) != NO_TEXT) {
+        A68_SP = arg_sp;
+        PUSH_VALUE (p, VALUE (&width), A68_INT);
+        PUSH_VALUE (p, VALUE (&after) != 0 ? VALUE (&after) - 1 : 0, A68_INT);
+        PUSH_VALUE (p, VALUE (&expo) > 0 ? VALUE (&expo) + 1 : VALUE (&expo) - 1, A68_INT);
+        PUSH_VALUE (p, VALUE (&frmt), A68_INT);
+        return real (p);
+      } else {
+        return s;
+      }
+    } else {
+      char *s = stack_string (p, 8 + ABS (VALUE (&width)));
+      return error_chars (s, VALUE (&width));
+    }
+  }
+#endif
   if (mode == M_REAL) {
     REAL_T x = VALUE ((A68_REAL *) (STACK_OFFSET (A68_UNION_SIZE)));
     int before = ABS (VALUE (&width)) - ABS (VALUE (&expo)) - (VALUE (&after) != 0 ? VALUE (&after) + 1 : 0) - 2;
@@ -2617,7 +3097,7 @@ char *real (NODE_T * p)
     }
   }
   if (mode == M_INT) {
-    int x = VALUE ((A68_INT *) (STACK_OFFSET (A68_UNION_SIZE)));
+    INT_T x = VALUE ((A68_INT *) (STACK_OFFSET (A68_UNION_SIZE)));
     PUSH_UNION (p, M_REAL);
     PUSH_VALUE (p, (REAL_T) x, A68_REAL);
     INCREMENT_STACK_POINTER (p, SIZE (M_NUMBER) - (A68_UNION_SIZE + SIZE (M_REAL)));
@@ -2805,15 +3285,21 @@ A68C_TRANSPUT (long_mp_complex, long_mp_real, LONG_LONG_COMPLEX);
 void genie_read_line (NODE_T * p)
 {
 #if defined (HAVE_READLINE)
-  char *line = readline ("");
-  if (line != NO_TEXT && (int) strlen (line) > 0) {
-    add_history (line);
+// Readline cannot see chars that are buffered for stand in.
+  A68_FILE *f = FILE_DEREF (&A68 (stand_in));
+  int k = TRANSPUT_BUFFER (f);
+  if (FD (f) == STDIN_FILENO && isatty (STDIN_FILENO) && get_transput_buffer_index (k) == 0 && get_read_buffer_reserve (k) == 0) {
+    flush_write_buffers ();
+    char *line = readline ("");
+    if (line != NO_TEXT && (int) strlen (line) > 0) {
+      add_history (line);
+    }
+    PUSH_REF (p, c_to_a_string (p, line, DEFAULT_WIDTH));
+    a68_free (line);
+    return;
   }
-  PUSH_REF (p, c_to_a_string (p, line, DEFAULT_WIDTH));
-  a68_free (line);
-#else
+#endif
   genie_read_string (p);
   genie_stand_in (p);
   genie_new_line (p);
-#endif
 }
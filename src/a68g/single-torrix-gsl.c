@@ -119,6 +119,146 @@ void push_vector (NODE_T * p, gsl_vector * v)
   PUSH_REF (p, vector_to_row (p, v));
 }
 
+// An A68_REAL is a status word followed by its value, hence the values in a
+// [] REAL form a strided array of REAL_T that GSL can address in place.
+// Vector operands and results are therefore viewed rather than copied.
+
+//! @brief Set up a gsl_vector that views the values of a [] REAL in the heap.
+
+static void view_vector (gsl_vector * v, A68_ARRAY * arr, A68_TUPLE * tup)
+{
+  int inc = SPAN (tup) * ELEM_SIZE (arr);
+  ABEND (inc % (int) sizeof (REAL_T) != 0, ERROR_INTERNAL_CONSISTENCY, __func__);
+  SIZE (v) = (size_t) ROW_SIZE (tup);
+  v->stride = (size_t) (inc / (int) sizeof (REAL_T));
+  v->block = NULL;
+  v->owner = 0;
+  if (SIZE (v) > 0) {
+    A68_REAL *x = (A68_REAL *) & (DEREF (BYTE_T, &ARRAY (arr))[VECTOR_OFFSET (arr, tup)]);
+    DATA (v) = &VALUE (x);
+  } else {
+    DATA (v) = NULL;
+  }
+}
+
+//! @brief Set up a gsl_vector that views the values of [] REAL "desc", checking initialisation.
+
+static void get_vector_view (NODE_T * p, A68_REF * desc, gsl_vector * v)
+{
+  A68_ARRAY *arr; A68_TUPLE *tup;
+  CHECK_REF (p, *desc, M_ROW_REAL);
+  GET_DESCRIPTOR (arr, tup, desc);
+  view_vector (v, arr, tup);
+  int len = ROW_SIZE (tup);
+  if (len > 0) {
+    BYTE_T *base = DEREF (BYTE_T, &ARRAY (arr));
+    int idx = VECTOR_OFFSET (arr, tup);
+    int inc = SPAN (tup) * ELEM_SIZE (arr);
+    for (int k = 0; k < len; k++, idx += inc) {
+      A68_REAL *x = (A68_REAL *) (base + idx);
+      CHECK_INIT (p, INITIALISED (x), M_REAL);
+    }
+  }
+}
+
+//! @brief Pop [] REAL on the stack as a gsl_vector that views its values.
+
+static void pop_vector_view (NODE_T * p, gsl_vector * v)
+{
+  A68_REF desc;
+  POP_REF (p, &desc);
+  get_vector_view (p, &desc, v);
+}
+
+//! @brief Generate a [] REAL of zeroes and a gsl_vector that views its values.
+
+static A68_ROW new_vector_view (NODE_T * p, size_t len, gsl_vector * v)
+{
+  A68_ROW desc, row; A68_ARRAY arr; A68_TUPLE tup;
+  NEW_ROW_1D (desc, row, arr, tup, M_ROW_REAL, M_REAL, (int) len);
+  BYTE_T *base = DEREF (BYTE_T, &ARRAY (&arr));
+  int idx = VECTOR_OFFSET (&arr, &tup);
+  int inc = SPAN (&tup) * ELEM_SIZE (&arr);
+  for (size_t k = 0; k < len; k++, idx += inc) {
+    A68_REAL *x = (A68_REAL *) (base + idx);
+    STATUS (x) = INIT_MASK;
+    VALUE (x) = 0.0;
+  }
+  view_vector (v, &arr, &tup);
+  return desc;
+}
+
+//! @brief Check the values of a result computed in place.
+
+static void check_vector_view (NODE_T * p, gsl_vector * v)
+{
+  for (size_t k = 0; k < SIZE (v); k++) {
+    CHECK_REAL (p, gsl_vector_get (v, k));
+  }
+}
+
+//! @brief Check the values of a result computed in place and push its row.
+
+static void push_vector_view (NODE_T * p, A68_ROW desc, gsl_vector * v)
+{
+  check_vector_view (p, v);
+  PUSH_REF (p, desc);
+}
+
+//! @brief View the destination of an assigning operator, the REF [] REAL on top of the stack.
+
+static void get_vector_ab (NODE_T * p, gsl_vector * u)
+{
+  A68_REF *dst = (A68_REF *) STACK_OFFSET (-A68_REF_SIZE);
+  CHECK_REF (p, *dst, M_REF_ROW_REAL);
+  A68_ROW *row = DEREF (A68_ROW, dst);
+  get_vector_view (p, row, u);
+// As in u := u + v, where u + v yields a [1 : n] row.
+  A68_ARRAY *arr; A68_TUPLE *tup;
+  GET_DESCRIPTOR (arr, tup, row);
+  if (ROW_SIZE (tup) > 0 && LWB (tup) != 1) {
+    diagnostic (A68_RUNTIME_ERROR, p, ERROR_DIFFERENT_BOUNDS);
+    exit_genie (p, A68_RUNTIME_ERROR);
+  }
+  (void) arr;
+}
+
+//! @brief Whether distinct views "u" and "v" share elements.
+
+static BOOL_T vectors_overlap (gsl_vector * u, gsl_vector * v)
+{
+  if (SIZE (u) == 0 || SIZE (v) == 0) {
+    return A68_FALSE;
+  } else if (DATA (u) == DATA (v) && u->stride == v->stride) {
+    return A68_FALSE;
+  } else {
+    REAL_T *u_end = DATA (u) + (SIZE (u) - 1) * u->stride;
+    REAL_T *v_end = DATA (v) + (SIZE (v) - 1) * v->stride;
+    return (BOOL_T) (DATA (u) <= v_end && DATA (v) <= u_end);
+  }
+}
+
+//! @brief Perform elementwise operation on the destination in place (+:=, -:=).
+
+static void op_ab_vector (NODE_T * p, int (*op) (gsl_vector *, const gsl_vector *))
+{
+  gsl_error_handler_t *save_handler = gsl_set_error_handler (torrix_error_handler);
+  gsl_vector u, v;
+  pop_vector_view (p, &v);
+  get_vector_ab (p, &u);
+  if (vectors_overlap (&u, &v)) {
+// Operand and destination are different slices of one row.
+    gsl_vector *w = gsl_vector_alloc (SIZE (&v));
+    ASSERT_GSL (gsl_vector_memcpy (w, &v));
+    ASSERT_GSL ((*op) (&u, w));
+    gsl_vector_free (w);
+  } else {
+    ASSERT_GSL ((*op) (&u, &v));
+  }
+  check_vector_view (p, &u);
+  (void) gsl_set_error_handler (save_handler);
+}
+
 //! @brief Pop [, ] REAL on the stack as gsl_matrix.
 
 gsl_matrix *pop_matrix (NODE_T * p, BOOL_T get)
@@ -293,9 +433,11 @@ void op_ab_torrix (NODE_T * p, MOID_T * m, MOID_T * n, GPROC * op)
 void genie_vector_echo (NODE_T * p)
 {
   gsl_error_handler_t *save_handler = gsl_set_error_handler (torrix_error_handler);
-  gsl_vector *u = pop_vector (p, A68_TRUE);
-  push_vector (p, u);
-  gsl_vector_free (u);
+  gsl_vector u, v;
+  pop_vector_view (p, &u);
+  A68_ROW desc = new_vector_view (p, SIZE (&u), &v);
+  ASSERT_GSL (gsl_vector_memcpy (&v, &u));
+  push_vector_view (p, desc, &v);
   (void) gsl_set_error_handler (save_handler);
 }
 
@@ -365,10 +507,12 @@ void genie_vector_col (NODE_T * p)
 void genie_vector_minus (NODE_T * p)
 {
   gsl_error_handler_t *save_handler = gsl_set_error_handler (torrix_error_handler);
-  gsl_vector *u = pop_vector (p, A68_TRUE);
-  ASSERT_GSL (gsl_vector_scale (u, -1));
-  push_vector (p, u);
-  gsl_vector_free (u);
+  gsl_vector u, v;
+  pop_vector_view (p, &u);
+  A68_ROW desc = new_vector_view (p, SIZE (&u), &v);
+  ASSERT_GSL (gsl_vector_memcpy (&v, &u));
+  ASSERT_GSL (gsl_vector_scale (&v, -1));
+  push_vector_view (p, desc, &v);
   (void) gsl_set_error_handler (save_handler);
 }
 
@@ -557,12 +701,13 @@ void genie_matrix_complex_minus (NODE_T * p)
 void genie_vector_add (NODE_T * p)
 {
   gsl_error_handler_t *save_handler = gsl_set_error_handler (torrix_error_handler);
-  gsl_vector *v = pop_vector (p, A68_TRUE);
-  gsl_vector *u = pop_vector (p, A68_TRUE);
-  ASSERT_GSL (gsl_vector_add (u, v));
-  push_vector (p, u);
-  gsl_vector_free (u);
-  gsl_vector_free (v);
+  gsl_vector u, v, w;
+  pop_vector_view (p, &v);
+  pop_vector_view (p, &u);
+  A68_ROW desc = new_vector_view (p, SIZE (&u), &w);
+  ASSERT_GSL (gsl_vector_memcpy (&w, &u));
+  ASSERT_GSL (gsl_vector_add (&w, &v));
+  push_vector_view (p, desc, &w);
   (void) gsl_set_error_handler (save_handler);
 }
 
@@ -571,12 +716,13 @@ void genie_vector_add (NODE_T * p)
 void genie_vector_sub (NODE_T * p)
 {
   gsl_error_handler_t *save_handler = gsl_set_error_handler (torrix_error_handler);
-  gsl_vector *v = pop_vector (p, A68_TRUE);
-  gsl_vector *u = pop_vector (p, A68_TRUE);
-  ASSERT_GSL (gsl_vector_sub (u, v));
-  push_vector (p, u);
-  gsl_vector_free (u);
-  gsl_vector_free (v);
+  gsl_vector u, v, w;
+  pop_vector_view (p, &v);
+  pop_vector_view (p, &u);
+  A68_ROW desc = new_vector_view (p, SIZE (&u), &w);
+  ASSERT_GSL (gsl_vector_memcpy (&w, &u));
+  ASSERT_GSL (gsl_vector_sub (&w, &v));
+  push_vector_view (p, desc, &w);
   (void) gsl_set_error_handler (save_handler);
 }
 
@@ -585,12 +731,15 @@ void genie_vector_sub (NODE_T * p)
 void genie_vector_eq (NODE_T * p)
 {
   gsl_error_handler_t *save_handler = gsl_set_error_handler (torrix_error_handler);
-  gsl_vector *v = pop_vector (p, A68_TRUE);
-  gsl_vector *u = pop_vector (p, A68_TRUE);
-  ASSERT_GSL (gsl_vector_sub (u, v));
-  PUSH_VALUE (p, (BOOL_T) (gsl_vector_isnull (u) ? A68_TRUE : A68_FALSE), A68_BOOL);
-  gsl_vector_free (u);
-  gsl_vector_free (v);
+  gsl_vector u, v;
+  pop_vector_view (p, &v);
+  pop_vector_view (p, &u);
+  ASSERT_GSL (SIZE (&u) == SIZE (&v) ? GSL_SUCCESS : GSL_EBADLEN);
+  BOOL_T eq = A68_TRUE;
+  for (size_t k = 0; k < SIZE (&u) && eq; k++) {
+    eq = (BOOL_T) (gsl_vector_get (&u, k) == gsl_vector_get (&v, k));
+  }
+  PUSH_VALUE (p, eq, A68_BOOL);
   (void) gsl_set_error_handler (save_handler);
 }
 
@@ -606,14 +755,14 @@ void genie_vector_ne (NODE_T * p)
 
 void genie_vector_plusab (NODE_T * p)
 {
-  op_ab_torrix (p, M_REF_ROW_REAL, M_ROW_REAL, genie_vector_add);
+  op_ab_vector (p, gsl_vector_add);
 }
 
 //! @brief OP -:= = (REF [] REAL, [] REAL) REF [] REAL
 
 void genie_vector_minusab (NODE_T * p)
 {
-  op_ab_torrix (p, M_REF_ROW_REAL, M_ROW_REAL, genie_vector_sub);
+  op_ab_vector (p, gsl_vector_sub);
 }
 
 //! @brief OP + = ([, ] REAL, [, ] REAL) [, ] REAL
@@ -821,10 +970,12 @@ void genie_vector_scale_real (NODE_T * p)
   gsl_error_handler_t *save_handler = gsl_set_error_handler (torrix_error_handler);
   A68_REAL v;
   POP_OBJECT (p, &v, A68_REAL);
-  gsl_vector *u = pop_vector (p, A68_TRUE);
-  ASSERT_GSL (gsl_vector_scale (u, VALUE (&v)));
-  push_vector (p, u);
-  gsl_vector_free (u);
+  gsl_vector u, w;
+  pop_vector_view (p, &u);
+  A68_ROW desc = new_vector_view (p, SIZE (&u), &w);
+  ASSERT_GSL (gsl_vector_memcpy (&w, &u));
+  ASSERT_GSL (gsl_vector_scale (&w, VALUE (&v)));
+  push_vector_view (p, desc, &w);
   (void) gsl_set_error_handler (save_handler);
 }
 
@@ -833,12 +984,14 @@ void genie_vector_scale_real (NODE_T * p)
 void genie_real_scale_vector (NODE_T * p)
 {
   gsl_error_handler_t *save_handler = gsl_set_error_handler (torrix_error_handler);
-  gsl_vector *u = pop_vector (p, A68_TRUE);
+  gsl_vector u, w;
+  pop_vector_view (p, &u);
   A68_REAL v;
   POP_OBJECT (p, &v, A68_REAL);
-  ASSERT_GSL (gsl_vector_scale (u, VALUE (&v)));
-  push_vector (p, u);
-  gsl_vector_free (u);
+  A68_ROW desc = new_vector_view (p, SIZE (&u), &w);
+  ASSERT_GSL (gsl_vector_memcpy (&w, &u));
+  ASSERT_GSL (gsl_vector_scale (&w, VALUE (&v)));
+  push_vector_view (p, desc, &w);
   (void) gsl_set_error_handler (save_handler);
 }
 
@@ -938,7 +1091,14 @@ void genie_complex_scale_matrix_complex (NODE_T * p)
 
 void genie_vector_scale_real_ab (NODE_T * p)
 {
-  op_ab_torrix (p, M_REF_ROW_REAL, M_REAL, genie_vector_scale_real);
+  gsl_error_handler_t *save_handler = gsl_set_error_handler (torrix_error_handler);
+  A68_REAL v;
+  POP_OBJECT (p, &v, A68_REAL);
+  gsl_vector u;
+  get_vector_ab (p, &u);
+  ASSERT_GSL (gsl_vector_scale (&u, VALUE (&v)));
+  check_vector_view (p, &u);
+  (void) gsl_set_error_handler (save_handler);
 }
 
 //! @brief OP *:= (REF [, ] REAL, REAL) REF [, ] REAL
@@ -973,10 +1133,12 @@ void genie_vector_div_real (NODE_T * p)
     diagnostic (A68_RUNTIME_ERROR, p, ERROR_DIVISION_BY_ZERO, M_ROW_REAL);
     exit_genie (p, A68_RUNTIME_ERROR);
   }
-  gsl_vector *u = pop_vector (p, A68_TRUE);
-  ASSERT_GSL (gsl_vector_scale (u, 1.0 / VALUE (&v)));
-  push_vector (p, u);
-  gsl_vector_free (u);
+  gsl_vector u, w;
+  pop_vector_view (p, &u);
+  A68_ROW desc = new_vector_view (p, SIZE (&u), &w);
+  ASSERT_GSL (gsl_vector_memcpy (&w, &u));
+  ASSERT_GSL (gsl_vector_scale (&w, 1.0 / VALUE (&v)));
+  push_vector_view (p, desc, &w);
   (void) gsl_set_error_handler (save_handler);
 }
 
@@ -1044,7 +1206,172 @@ void genie_matrix_complex_div_complex (NODE_T * p)
 
 void genie_vector_div_real_ab (NODE_T * p)
 {
-  op_ab_torrix (p, M_REF_ROW_REAL, M_REAL, genie_vector_div_real);
+  gsl_error_handler_t *save_handler = gsl_set_error_handler (torrix_error_handler);
+  A68_REAL v;
+  POP_OBJECT (p, &v, A68_REAL);
+  if (VALUE (&v) == 0.0) {
+    diagnostic (A68_RUNTIME_ERROR, p, ERROR_DIVISION_BY_ZERO, M_ROW_REAL);
+    exit_genie (p, A68_RUNTIME_ERROR);
+  }
+  gsl_vector u;
+  get_vector_ab (p, &u);
+  ASSERT_GSL (gsl_vector_scale (&u, 1.0 / VALUE (&v)));
+  check_vector_view (p, &u);
+  (void) gsl_set_error_handler (save_handler);
+}
+
+
+// Formulas that chain elementwise [] REAL operators, like a + b * 2.0 - c,
+// are evaluated in one pass into the result row instead of generating a
+// row per operator. Operands are elaborated as usual, after which the
+// formula runs as a postfix program over chunks small enough to stay in
+// cache.
+
+#define TORRIX_CHUNK 128
+#define TORRIX_STEPS 16
+
+//! @brief Whether "p" is a formula with an elementwise [] REAL operator from the standard environ.
+
+static BOOL_T is_torrix_elementwise (NODE_T * p)
+{
+  if (!IS (p, FORMULA) || NEXT (SUB (p)) == NO_NODE) {
+    return A68_FALSE;
+  }
+  GPROC *proc = PROCEDURE (TAX (NEXT (SUB (p))));
+  return (BOOL_T) (proc == genie_vector_add || proc == genie_vector_sub || proc == genie_vector_scale_real || proc == genie_real_scale_vector || proc == genie_vector_div_real);
+}
+
+//! @brief Append operands and operators of formula "p" in postfix order.
+
+static BOOL_T torrix_steps (NODE_T * p, NODE_T ** steps, int *n)
+{
+  NODE_T *u = SUB (p), *op = NEXT (u), *v = NEXT (op);
+  NODE_T *q[2] = {u, v};
+  for (int k = 0; k < 2; k++) {
+    if (is_torrix_elementwise (q[k])) {
+      if (!torrix_steps (q[k], steps, n)) {
+        return A68_FALSE;
+      }
+    } else if (*n == TORRIX_STEPS) {
+      return A68_FALSE;
+    } else {
+      steps[(*n)++] = q[k];
+    }
+  }
+  if (*n == TORRIX_STEPS) {
+    return A68_FALSE;
+  }
+  steps[(*n)++] = op;
+  return A68_TRUE;
+}
+
+//! @brief Whether formula "p" chains elementwise [] REAL operators that can be fused.
+
+BOOL_T is_torrix_fusable (NODE_T * p)
+{
+  if (!is_torrix_elementwise (p)) {
+    return A68_FALSE;
+  }
+  NODE_T *u = SUB (p), *v = NEXT_NEXT (u), *steps[TORRIX_STEPS];
+  int n = 0;
+  return (BOOL_T) ((is_torrix_elementwise (u) || is_torrix_elementwise (v)) && torrix_steps (p, steps, &n));
+}
+
+//! @brief Push result of formula that chains elementwise [] REAL operators.
+
+PROP_T genie_formula_torrix (NODE_T * p)
+{
+  NODE_T *steps[TORRIX_STEPS];
+  int n = 0;
+  ADDR_T pop_sp = A68_SP;
+  (void) torrix_steps (p, steps, &n);
+  for (int k = 0; k < n; k++) {
+    if (!IS (steps[k], OPERATOR)) {
+      EXECUTE_UNIT (steps[k]);
+      STACK_DNS (steps[k], MOID (steps[k]), A68_FP);
+    }
+  }
+// Operands are viewed only now, as elaborating an operand may sweep the heap.
+  gsl_vector vec[TORRIX_STEPS];
+  REAL_T val[TORRIX_STEPS];
+  ADDR_T sp = pop_sp;
+  size_t len = 0;
+  BOOL_T first = A68_TRUE;
+  for (int k = 0; k < n; k++) {
+    NODE_T *q = steps[k];
+    if (IS (q, OPERATOR)) {
+      if (PROCEDURE (TAX (q)) == genie_vector_div_real && val[k - 1] == 0.0) {
+        diagnostic (A68_RUNTIME_ERROR, q, ERROR_DIVISION_BY_ZERO, M_ROW_REAL);
+        exit_genie (q, A68_RUNTIME_ERROR);
+      }
+    } else if (MOID (q) == M_REAL) {
+      val[k] = VALUE ((A68_REAL *) STACK_ADDRESS (sp));
+      sp += SIZE (M_REAL);
+    } else {
+      get_vector_view (q, (A68_REF *) STACK_ADDRESS (sp), &vec[k]);
+      sp += A68_REF_SIZE;
+      if (first) {
+        len = SIZE (&vec[k]);
+        first = A68_FALSE;
+      } else if (SIZE (&vec[k]) != len) {
+        torrix_error_handler ("vectors must have same length", "", 0, GSL_EBADLEN);
+      }
+    }
+  }
+  gsl_vector w;
+  A68_ROW desc = new_vector_view (p, len, &w);
+  REAL_T chunk[TORRIX_STEPS][TORRIX_CHUNK], scalars[TORRIX_STEPS];
+  for (size_t lwb = 0; lwb < len; lwb += TORRIX_CHUNK) {
+    size_t m = MIN (len - lwb, TORRIX_CHUNK);
+    int top = -1, sca = -1;
+    for (int k = 0; k < n; k++) {
+      NODE_T *q = steps[k];
+      if (!IS (q, OPERATOR)) {
+        if (MOID (q) == M_REAL) {
+          scalars[++sca] = val[k];
+        } else {
+          size_t stride = vec[k].stride;
+          REAL_T *x = DATA (&vec[k]) + lwb * stride, *y = chunk[++top];
+          for (size_t i = 0; i < m; i++, x += stride) {
+            y[i] = *x;
+          }
+        }
+      } else {
+        GPROC *proc = PROCEDURE (TAX (q));
+        if (proc == genie_vector_add || proc == genie_vector_sub) {
+          REAL_T *z = chunk[top--], *y = chunk[top];
+          if (proc == genie_vector_add) {
+            for (size_t i = 0; i < m; i++) {
+              y[i] += z[i];
+            }
+          } else {
+            for (size_t i = 0; i < m; i++) {
+              y[i] -= z[i];
+            }
+          }
+        } else {
+          REAL_T *y = chunk[top], f = scalars[sca--];
+          if (proc == genie_vector_div_real) {
+            f = 1.0 / f;
+          }
+          for (size_t i = 0; i < m; i++) {
+            y[i] *= f;
+          }
+        }
+      }
+    }
+    REAL_T *x = DATA (&w) + lwb * w.stride, *y = chunk[0];
+    for (size_t i = 0; i < m; i++, x += w.stride) {
+      CHECK_REAL (p, y[i]);
+      *x = y[i];
+    }
+  }
+  A68_SP = pop_sp;
+  PUSH_REF (p, desc);
+  PROP_T self;
+  UNIT (&self) = genie_formula_torrix;
+  SOURCE (&self) = p;
+  return self;
 }
 
 //! @brief OP /:= (REF [, ] REAL, REAL) REF [, ] REAL
@@ -1073,13 +1400,12 @@ void genie_matrix_complex_div_complex_ab (NODE_T * p)
 void genie_vector_dot (NODE_T * p)
 {
   gsl_error_handler_t *save_handler = gsl_set_error_handler (torrix_error_handler);
-  gsl_vector *v = pop_vector (p, A68_TRUE);
-  gsl_vector *u = pop_vector (p, A68_TRUE);
+  gsl_vector u, v;
+  pop_vector_view (p, &v);
+  pop_vector_view (p, &u);
   REAL_T w;
-  ASSERT_GSL (gsl_blas_ddot (u, v, &w));
+  ASSERT_GSL (gsl_blas_ddot (&u, &v, &w));
   PUSH_VALUE (p, w, A68_REAL);
-  gsl_vector_free (u);
-  gsl_vector_free (v);
   (void) gsl_set_error_handler (save_handler);
 }
 
@@ -1104,9 +1430,9 @@ void genie_vector_complex_dot (NODE_T * p)
 void genie_vector_norm (NODE_T * p)
 {
   gsl_error_handler_t *save_handler = gsl_set_error_handler (torrix_error_handler);
-  gsl_vector *u = pop_vector (p, A68_TRUE);
-  PUSH_VALUE (p, gsl_blas_dnrm2 (u), A68_REAL);
-  gsl_vector_free (u);
+  gsl_vector u;
+  pop_vector_view (p, &u);
+  PUSH_VALUE (p, gsl_blas_dnrm2 (&u), A68_REAL);
   (void) gsl_set_error_handler (save_handler);
 }
 
@@ -1126,20 +1452,19 @@ void genie_vector_complex_norm (NODE_T * p)
 void genie_vector_dyad (NODE_T * p)
 {
   gsl_error_handler_t *save_handler = gsl_set_error_handler (torrix_error_handler);
-  gsl_vector *v = pop_vector (p, A68_TRUE);
-  gsl_vector *u = pop_vector (p, A68_TRUE);
-  int len1 = (int) (SIZE (u)), len2 = (int) (SIZE (v));
+  gsl_vector u, v;
+  pop_vector_view (p, &v);
+  pop_vector_view (p, &u);
+  int len1 = (int) (SIZE (&u)), len2 = (int) (SIZE (&v));
   gsl_matrix *w = gsl_matrix_calloc ((size_t) len1, (size_t) len2);
   for (int j = 0; j < len1; j++) {
-    REAL_T uj = gsl_vector_get (u, (size_t) j);
+    REAL_T uj = gsl_vector_get (&u, (size_t) j);
     for (int k = 0; k < len2; k++) {
-      REAL_T vk = gsl_vector_get (v, (size_t) k);
+      REAL_T vk = gsl_vector_get (&v, (size_t) k);
       gsl_matrix_set (w, (size_t) j, (size_t) k, uj * vk);
     }
   }
   push_matrix (p, w);
-  gsl_vector_free (u);
-  gsl_vector_free (v);
   gsl_matrix_free (w);
   (void) gsl_set_error_handler (save_handler);
 }
@@ -1172,15 +1497,12 @@ void genie_vector_complex_dyad (NODE_T * p)
 void genie_matrix_times_vector (NODE_T * p)
 {
   gsl_error_handler_t *save_handler = gsl_set_error_handler (torrix_error_handler);
-  gsl_vector *u = pop_vector (p, A68_TRUE);
+  gsl_vector u, v;
+  pop_vector_view (p, &u);
   gsl_matrix *w = pop_matrix (p, A68_TRUE);
-  int len = (int) (SIZE (u));
-  gsl_vector *v = gsl_vector_calloc ((size_t) len);
-  gsl_vector_set_zero (v);
-  ASSERT_GSL (gsl_blas_dgemv (CblasNoTrans, 1.0, w, u, 0.0, v));
-  push_vector (p, v);
-  gsl_vector_free (u);
-  gsl_vector_free (v);
+  A68_ROW desc = new_vector_view (p, SIZE1 (w), &v);
+  ASSERT_GSL (gsl_blas_dgemv (CblasNoTrans, 1.0, w, &u, 0.0, &v));
+  push_vector_view (p, desc, &v);
   gsl_matrix_free (w);
   (void) gsl_set_error_handler (save_handler);
 }
@@ -1191,15 +1513,11 @@ void genie_vector_times_matrix (NODE_T * p)
 {
   gsl_error_handler_t *save_handler = gsl_set_error_handler (torrix_error_handler);
   gsl_matrix *w = pop_matrix (p, A68_TRUE);
-  ASSERT_GSL (gsl_matrix_transpose (w));
-  gsl_vector *u = pop_vector (p, A68_TRUE);
-  int len = (int) (SIZE (u));
-  gsl_vector *v = gsl_vector_calloc ((size_t) len);
-  gsl_vector_set_zero (v);
-  ASSERT_GSL (gsl_blas_dgemv (CblasNoTrans, 1.0, w, u, 0.0, v));
-  push_vector (p, v);
-  gsl_vector_free (u);
-  gsl_vector_free (v);
+  gsl_vector u, v;
+  pop_vector_view (p, &u);
+  A68_ROW desc = new_vector_view (p, SIZE2 (w), &v);
+  ASSERT_GSL (gsl_blas_dgemv (CblasTrans, 1.0, w, &u, 0.0, &v));
+  push_vector_view (p, desc, &v);
   gsl_matrix_free (w);
   (void) gsl_set_error_handler (save_handler);
 }
@@ -70,6 +70,10 @@ struct MODE_CACHE_T
 
 #define MAX_OPEN_FILES 64       // Some OS's won't open more than this number
 #define MAX_TRANSPUT_BUFFER (MAX_OPEN_FILES)
+#define REGEX_CACHE_SIZE 16
+#define MAX_HEAP_SEGMENTS 64    // Segments add at least a quarter to the heap, so this covers any address space
+#define HEAP_LIMIT_FACTOR 8     // By default the heap grows up to this multiple of its initial size
+#define MARK_STACK_SIZE 1024    // Initial entries in the mark stack of the garbage collector
 
 typedef struct FILE_ENTRY FILE_ENTRY;
 struct FILE_ENTRY
@@ -80,6 +84,28 @@ struct FILE_ENTRY
   A68_REF idf;
 };
 
+// Read-ahead buffer for a file, indexed like its transput buffer.
+// A mapped buffer holds the whole file.
+
+typedef struct READ_BUFFER READ_BUFFER;
+struct READ_BUFFER
+{
+  BOOL_T mapped;
+  char *data;
+  size_t size, index, count;
+};
+
+// Write buffer for a file, indexed like its transput buffer.
+
+typedef struct WRITE_BUFFER WRITE_BUFFER;
+struct WRITE_BUFFER
+{
+  BOOL_T line_buffered;
+  char *data;
+  FILE_T fd;
+  size_t size, count;
+};
+
 // Administration for common (sub) expression elimination.
 // BOOK keeps track of already seen (temporary) variables and denotations.
 
@@ -116,14 +142,54 @@ struct UNIC_T
 #define A68_HEAP       A68 (heap_segment)
 #define A68_HANDLES    A68 (handle_segment)
 
+typedef struct REGEX_CACHE_T REGEX_CACHE_T;
+struct REGEX_CACHE_T
+{
+  char *pattern;
+  int flags, nmatch;
+  regex_t compiled;
+  regmatch_t *matches;
+  UNSIGNED_T used;
+};
+
+typedef struct REGEX_GLOBALS_T REGEX_GLOBALS_T;
+#define A68_REGEX(z)   A68 (regex.z)
+struct REGEX_GLOBALS_T
+{
+  REGEX_CACHE_T cache[REGEX_CACHE_SIZE];
+  UNSIGNED_T clock, hits, misses;
+};
+
+typedef struct HEAP_SEGMENT_T HEAP_SEGMENT_T;
+struct HEAP_SEGMENT_T
+{
+  BOOL_T mapped;
+  BYTE_T *start;
+  ADDR_T base, size;
+};
+
+typedef struct MARK_T MARK_T;
+struct MARK_T
+{
+  BYTE_T *pointer;
+  MOID_T *type;
+  A68_HANDLE *handle;
+};
+
 typedef struct GC_GLOBALS_T GC_GLOBALS_T;
 #define A68_GC(z)      A68 (gc.z)
 struct GC_GLOBALS_T
 {
   A68_HANDLE *available_handles, *busy_handles;
-  UNSIGNED_T free_handles, max_handles, sweeps, refused, freed, total;
+  UNSIGNED_T free_handles, max_handles, fresh_handles, sweeps, refused, freed, total;
+  UNSIGNED_T minor_sweeps, minor_total, allocation_sweeps;
+  ADDR_T old_heap_pointer, heap_capacity, allocated;
+  HEAP_SEGMENT_T heap_segments[MAX_HEAP_SEGMENTS], handle_segments[MAX_HEAP_SEGMENTS];
+  A68_HANDLE **pins;
+  MARK_T *marks;
+  int heap_segment_count, handle_segment_count, pin_count, mark_count, max_marks;
   unt preemptive;
-  REAL_T seconds;
+  REAL_T seconds, last_seconds, mutator_start, rate, survival, threshold;
 };
 
 typedef struct INDENT_GLOBALS_T INDENT_GLOBALS_T;
@@ -219,6 +285,7 @@ struct A68_THREAD_CONTEXT
   BOOL_T active;
   BYTE_T *thread_stack_offset;
   int stack_used;
+  jmp_buf *thread_exit;
   NODE_T *unit;
   pthread_t parent, id;
 };
@@ -252,11 +319,15 @@ struct PARALLEL_GLOBALS_T
   BOOL_T abend_all_threads, exit_from_threads;
   int context_index;
   int par_return_code;
+  int stack_owner;
+  int pool_idle;
+  int pool_queue[THREAD_MAX];
   jmp_buf *jump_buffer;
   NODE_T *jump_label;
-  pthread_mutex_t unit_sema;
+  pthread_cond_t pool_cond, unit_cond;
+  pthread_mutex_t pool_sema, unit_sema;
   pthread_t main_thread_id;
-  pthread_t parent_thread_id;
+  unt pool_head, pool_tail;
 };
 
 #endif
@@ -271,6 +342,8 @@ struct PARSER_GLOBALS_T
   int max_scan_buf_length, source_file_size;
   int reductions;
   int tag_number;
+  TAG_INDEX_T **tag_index;
+  int tag_index_size, tag_index_count;
   jmp_buf bottom_up_crash_exit, top_down_crash_exit;
 };
 
@@ -284,6 +357,7 @@ struct GLOBALS_T
   A68_REF stand_in, stand_out, stand_back, stand_error, skip_file;
   ADDR_T fixed_heap_pointer, temp_heap_pointer;
   ADDR_T frame_pointer, stack_pointer, heap_pointer, global_pointer;
+  ADDR_T *display;
   ADDR_T frame_start, frame_end, stack_start, stack_end;
   BOOL_T close_tty_on_exit;
   BOOL_T curses_mode;
@@ -302,8 +376,11 @@ struct GLOBALS_T
   BUFFER output_line, edit_line, input_line;
   clock_t clock_res;
   FILE_ENTRY file_entries[MAX_OPEN_FILES];
+  READ_BUFFER read_buffers[MAX_TRANSPUT_BUFFER];
+  WRITE_BUFFER write_buffers[MAX_TRANSPUT_BUFFER];
   GC_GLOBALS_T gc;
   INDENT_GLOBALS_T indent;
+  REGEX_GLOBALS_T regex;
   int argc;
   int chars_in_tty_line;
   int global_level, max_lex_lvl;
@@ -331,6 +408,8 @@ struct GLOBALS_T
   TAG_T *error_tag;
   TOKEN_T *top_token;
   unt frame_stack_size, expr_stack_size, heap_size, handle_pool_size, stack_size;
+  ADDR_T heap_limit;
+  BOOL_T heap_limit_set;
   unt stack_limit, frame_stack_limit, expr_stack_limit;
   unt storage_overhead;
 #if defined (BUILD_PARALLEL_CLAUSE)
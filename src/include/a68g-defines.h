@@ -75,13 +75,16 @@
 #define MAX_RESTART 256
 
 #define A68_DIR ".a68g"
+#define A68_PLUGIN_CACHE_DIR "plugins"
 #define A68_HISTORY_FILE ".a68g.edit.hist"
 #define A68_NO_FILENO ((FILE_T) -1)
 #define A68_PROTECTION (S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH)  // -rw-r--r--
 #define A68_READ_ACCESS (O_RDONLY)
 #define A68_WRITE_ACCESS (O_WRONLY | O_CREAT | O_TRUNC)
 #define BUFFER_SIZE (KILOBYTE)
+#define DEFAULT_READ_BUFFER_SIZE (64 * KILOBYTE)
 #define DEFAULT_WIDTH (-1)
+#define DEFAULT_WRITE_BUFFER_SIZE (64 * KILOBYTE)
 
 #define EMBEDDED_FORMAT A68_TRUE
 #define EVEN(k) ((k) % 2 == 0)
@@ -92,6 +95,7 @@
 #define MAX_TERM_HEIGTH 24
 #define MAX_TERM_WIDTH (BUFFER_SIZE / 2)
 #define MIN_MEM_SIZE (128 * KILOBYTE)
+#define TAG_INDEX_SIZE 1024
 #define MOID_ERROR_WIDTH 80
 #define MOID_WIDTH 80
 #define MONADS "%^&+-~!?"
@@ -251,6 +255,7 @@
 #define ARRAY(p) ((p)->array)
 #define ATTRIBUTE(p) ((p)->attribute)
 #define B(p) ((p)->b)
+#define BASE(p) ((p)->base)
 #define BEGIN(p) ((p)->begin)
 #define BIN(p) ((p)->bin)
 #define BITS_PER_SAMPLE(p) ((p)->bits_per_sample)
@@ -282,6 +287,7 @@
 #define DATE(p) ((p)->date)
 #define DEF(p) ((p)->def)
 #define DEFLEXED(p) ((p)->deflexed_mode)
+#define DEPTH(p) ((p)->depth)
 #define DERIVATE(p) ((p)->derivate)
 #define DEVICE(p) ((p)->device)
 #define DEVICE_HANDLE(p) ((p)->device_handle)
@@ -348,10 +354,13 @@
 #define FILE_SOURCE_OPENED(p) (FILES (p).source.opened)
 #define FILE_SOURCE_WRITEMOOD(p) (FILES (p).source.writemood)
 #define FIND(p) ((p)->find)
+#define FLAGS(p) ((p)->flags)
 #define FORMAT(p) ((p)->format)
 #define FORMAT_END_MENDED(p) ((p)->format_end_mended)
 #define FORMAT_ERROR_MENDED(p) ((p)->format_error_mended)
 #define FRAME(p) ((p)->frame)
+#define FRAMELESS(p) ((p)->frameless)
+#define FRAME_DEPTH(p) ((p)->frame_depth)
 #define FRAME_LEVEL(p) ((p)->frame_level)
 #define FRAME_NO(p) ((p)->frame_no)
 #define FRAME_POINTER(p) ((p)->frame_pointer)
@@ -398,10 +407,12 @@
 #define LAST_LINE(p) ((p)->last_line)
 #define LESS(p) ((p)->less)
 #define LEVEL(p) ((p)->level)
+#define LEX_DEPTH(p) (DEPTH (TABLE (p)))
 #define LEX_LEVEL(p) (LEVEL (TABLE (p)))
 #define LINBUF(p) ((p)->linbuf)
 #define LINE(p) ((p)->line)
 #define LINE_APPLIED(p) ((p)->line_applied)
+#define LINE_BUFFERED(p) ((p)->line_buffered)
 #define LINE_DEFINED(p) ((p)->line_defined)
 #define LINE_END_MENDED(p) ((p)->line_end_mended)
 #define LINE_NUMBER(p) (NUMBER (LINE (INFO (p))))
@@ -412,8 +423,10 @@
 #define LOC_ASSIGNED(p) ((p)->loc_assigned)
 #define LOWER_BOUND(p) ((p)->lower_bound)
 #define LWB(p) ((p)->lower_bound)
+#define MAPPED(p) ((p)->mapped)
 #define MARKER(p) ((p)->marker)
 #define MATCH(p) ((p)->match)
+#define MATCHES(p) ((p)->matches)
 #define MODIFIED(p) ((p)->modified)
 #define MOID(p) ((p)->type)
 #define MORE(p) ((p)->more)
@@ -433,6 +446,7 @@
 #define NEXT_NEXT_NEXT(p) (NEXT (NEXT_NEXT (p)))
 #define NEXT_SUB(p) (NEXT (SUB (p)))
 #define NF(p) ((p)->nf)
+#define NMATCH(p) ((p)->nmatch)
 #define NODE(p) ((p)->node)
 #define NODE_DEFINED(p) ((p)->node_defined)
 #define NODE_PACK(p) ((p)->pack)
@@ -460,6 +474,7 @@
 #define OPTION_COMPILE(p) (OPTIONS (p).compile)
 #define OPTION_COMPILE_CHECK(p) (OPTIONS (p).compile_check)
 #define OPTION_CROSS_REFERENCE(p) (OPTIONS (p).cross_reference)
+#define OPTION_EXECUTABLE(p) (OPTIONS (p).executable)
 #define OPTION_DEBUG(p) (OPTIONS (p).debug)
 #define OPTION_FOLD(p) (OPTIONS (p).fold)
 #define OPTION_INDENT(p) (OPTIONS (p).indent)
@@ -467,15 +482,18 @@
 #define OPTION_LICENSE(p) (OPTIONS (p).license)
 #define OPTION_LIST(p) (OPTIONS (p).list)
 #define OPTION_LOCAL(p) (OPTIONS (p).local)
+#define OPTION_MAP_INPUT(p) (OPTIONS (p).map_input)
 #define OPTION_MOID_LISTING(p) (OPTIONS (p).moid_listing)
 #define OPTION_NODEMASK(p) (OPTIONS (p).nodemask)
 #define OPTION_NO_WARNINGS(p) (OPTIONS (p).no_warnings)
 #define OPTION_OBJECT_LISTING(p) (OPTIONS (p).object_listing)
 #define OPTION_OPT_LEVEL(p) (OPTIONS (p).opt_level)
+#define OPTION_PLUGIN_CACHE(p) (OPTIONS (p).plugin_cache)
 #define OPTION_PORTCHECK(p) (OPTIONS (p).portcheck)
 #define OPTION_PRAGMAT_SEMA(p) (OPTIONS (p).pragmat_sema)
 #define OPTION_PRETTY(p) (OPTIONS (p).pretty)
 #define OPTION_QUIET(p) (OPTIONS (p).quiet)
+#define OPTION_READ_BUFFER(p) (OPTIONS (p).read_buffer)
 #define OPTION_REDUCTIONS(p) (OPTIONS (p).reductions)
 #define OPTION_REGRESSION_TEST(p) (OPTIONS (p).regression_test)
 #define OPTION_RERUN(p) (OPTIONS (p).rerun)
@@ -492,6 +510,7 @@
 #define OPTION_UNUSED(p) (OPTIONS (p).unused)
 #define OPTION_VERBOSE(p) (OPTIONS (p).verbose)
 #define OPTION_VERSION(p) (OPTIONS (p).version)
+#define OPTION_WRITE_BUFFER(p) (OPTIONS (p).write_buffer)
 #define OUT(p) ((p)->out)
 #define OUTER(p) ((p)->outer)
 #define P(q) ((q)->p)
@@ -610,6 +629,7 @@
 #define TERMINATOR(p) ((p)->terminator)
 #define TEXT(p) ((p)->text)
 #define THREAD_ID(p) ((p)->thread_id)
+#define THREAD_EXIT(p) ((p)->thread_exit)
 #define THREAD_STACK_OFFSET(p) ((p)->thread_stack_offset)
 #define TMP_FILE(p) ((p)->tmp_file)
 #define TMP_TEXT(p) ((p)->tmp_text)
@@ -642,6 +662,7 @@
 #define UPB(p) ((p)->upper_bound)
 #define UPPER_BOUND(p) ((p)->upper_bound)
 #define USE(p) ((p)->use)
+#define USED(p) ((p)->used)
 #define VAL(p) ((p)->val)
 #define VALUE(p) ((p)->value)
 #define VALUE_ERROR_MENDED(p) ((p)->value_error_mended)
@@ -33,6 +33,7 @@
 #define FRAME_INCREMENT(n) (AP_INCREMENT (TABLE (FRAME_TREE(n))))
 #define FRAME_INFO_SIZE (A68_FRAME_ALIGN (sizeof (ACTIVATION_RECORD)))
 #define FRAME_JUMP_STAT(n) (JUMP_STAT (FACT (n)))
+#define FRAME_LEXICAL_DEPTH(n) (FRAME_DEPTH (FACT (n)))
 #define FRAME_LEXICAL_LEVEL(n) (FRAME_LEVEL (FACT (n)))
 #define FRAME_LOCAL(n, m) (FRAME_ADDRESS ((n) + FRAME_INFO_SIZE + (m)))
 #define FRAME_NUMBER(n) (FRAME_NO (FACT (n)))
@@ -49,31 +50,52 @@
 #define FRAME_THREAD_ID(n) (THREAD_ID (FACT (n)))
 #endif
 
-#define FOLLOW_SL(dest, l) {\
-  (dest) = A68_FP;\
-  if ((l) <= FRAME_PARAMETER_LEVEL ((dest))) {\
-    (dest) = FRAME_PARAMETERS ((dest));\
-  }\
-  while ((l) != FRAME_LEXICAL_LEVEL ((dest))) {\
-    (dest) = FRAME_STATIC_LINK ((dest));\
-  }}
+// Lexical levels number the symbol tables, so they are sparse along a static
+// chain. The display is therefore indexed by nesting depth of a range: entry
+// "d" holds the first frame on the static chain of the current frame with a
+// depth not exceeding "d". Non-local access then is a single indexed load.
+// The display is maintained when frames open or close; after any other change
+// of A68_FP it must be rebuilt with SET_DISPLAY (-1).
 
-#define FOLLOW_STATIC_LINK(dest, l) {\
-  if ((l) == A68 (global_level) && A68_GLOBALS > 0) {\
-    (dest) = A68_GLOBALS;\
-  } else {\
-    FOLLOW_SL (dest, l)\
-  }}
+#define FOLLOW_SL(dest, d) {\
+  (dest) = A68 (display)[d];\
+  }
+
+#define FOLLOW_STATIC_LINK(dest, d) FOLLOW_SL (dest, d)
+
+#define SET_DISPLAY(valid) set_display (A68_FP, (valid))
+
+//! @brief Make the display describe the static chain of frame "fp".
+//! Entries up to depth "valid" already describe some chain, so updating stops
+//! at the first entry that agrees with the new chain, since from there on both
+//! chains coincide.
+
+static inline void set_display (ADDR_T fp, int valid)
+{
+  ADDR_T z = fp;
+  for (int k = FRAME_LEXICAL_DEPTH (fp); k >= 0; k--) {
+    while (FRAME_LEXICAL_DEPTH (z) > k) {
+      if (z == A68 (frame_start)) {
+        return;
+      }
+      z = FRAME_STATIC_LINK (z);
+    }
+    if (k <= valid && A68 (display)[k] == z) {
+      return;
+    }
+    A68 (display)[k] = z;
+  }
+}
 
 #define FRAME_GET(dest, cast, p) {\
   ADDR_T _m_z;\
-  FOLLOW_STATIC_LINK (_m_z, LEVEL (GINFO (p)));\
+  FOLLOW_STATIC_LINK (_m_z, DEPTH (GINFO (p)));\
   (dest) = (cast *) & (OFFSET (GINFO (p))[_m_z]);\
   }
 
-#define GET_FRAME(dest, cast, level, offset) {\
+#define GET_FRAME(dest, cast, depth, offset) {\
   ADDR_T _m_z;\
-  FOLLOW_SL (_m_z, (level));\
+  FOLLOW_SL (_m_z, (depth));\
   (dest) = (cast *) & (A68_STACK [_m_z + FRAME_INFO_SIZE + (offset)]);\
   }
 
@@ -108,6 +130,19 @@
     initialise_frame (p);\
   }}
 
+// A range that declares nothing runs in the frame of its environ.
+
+#define OPEN_RANGE(p) {\
+  if (!FRAMELESS (TABLE (p))) {\
+    OPEN_STATIC_FRAME (p);\
+    INIT_STATIC_FRAME (p);\
+  }}
+
+#define CLOSE_RANGE(p) {\
+  if (!FRAMELESS (TABLE (p))) {\
+    CLOSE_FRAME;\
+  }}
+
 #define INIT_GLOBAL_POINTER(p) {\
   if (LEX_LEVEL (p) == A68 (global_level)) {\
     A68_GLOBALS = A68_FP;\
@@ -123,6 +158,7 @@
   act = FACT (A68_FP);\
   FRAME_NO (act) = FRAME_NO (pre) + 1;\
   FRAME_LEVEL (act) = LEX_LEVEL (p);\
+  FRAME_DEPTH (act) = LEX_DEPTH (p);\
   PARAMETER_LEVEL (act) = PARAMETER_LEVEL (pre);\
   PARAMETERS (act) = PARAMETERS (pre);\
   STATIC_LINK (act) = static_link;\
@@ -132,6 +168,7 @@
   JUMP_STAT (act) = NO_JMP_BUF;\
   PROC_FRAME (act) = A68_FALSE;\
   THREAD_ID (act) = pthread_self ();\
+  SET_DISPLAY (FRAME_DEPTH (pre));\
   }
 #else
 #define OPEN_STATIC_FRAME(p) {\
@@ -143,6 +180,7 @@
   act = FACT (A68_FP);\
   FRAME_NO (act) = FRAME_NO (pre) + 1;\
   FRAME_LEVEL (act) = LEX_LEVEL (p);\
+  FRAME_DEPTH (act) = LEX_DEPTH (p);\
   PARAMETER_LEVEL (act) = PARAMETER_LEVEL (pre);\
   PARAMETERS (act) = PARAMETERS (pre);\
   STATIC_LINK (act) = static_link;\
@@ -151,6 +189,7 @@
   NODE (act) = p;\
   JUMP_STAT (act) = NO_JMP_BUF;\
   PROC_FRAME (act) = A68_FALSE;\
+  SET_DISPLAY (FRAME_DEPTH (pre));\
   }
 #endif
 
@@ -171,6 +210,7 @@
   act = FACT (A68_FP);\
   FRAME_NO (act) = FRAME_NUMBER (dynamic_link) + 1;\
   FRAME_LEVEL (act) = LEX_LEVEL (p);\
+  FRAME_DEPTH (act) = LEX_DEPTH (p);\
   PARAMETER_LEVEL (act) = LEX_LEVEL (p);\
   PARAMETERS (act) = A68_FP;\
   STATIC_LINK (act) = static_link;\
@@ -180,6 +220,7 @@
   JUMP_STAT (act) = NO_JMP_BUF;\
   PROC_FRAME (act) = A68_TRUE;\
   THREAD_ID (act) = pthread_self ();\
+  SET_DISPLAY (FRAME_LEXICAL_DEPTH (dynamic_link));\
   }
 #else
 #define OPEN_PROC_FRAME(p, environ) {\
@@ -195,6 +236,7 @@
   act = FACT (A68_FP);\
   FRAME_NO (act) = FRAME_NUMBER (dynamic_link) + 1;\
   FRAME_LEVEL (act) = LEX_LEVEL (p);\
+  FRAME_DEPTH (act) = LEX_DEPTH (p);\
   PARAMETER_LEVEL (act) = LEX_LEVEL (p);\
   PARAMETERS (act) = A68_FP;\
   STATIC_LINK (act) = static_link;\
@@ -203,12 +245,14 @@
   NODE (act) = p;\
   JUMP_STAT (act) = NO_JMP_BUF;\
   PROC_FRAME (act) = A68_TRUE;\
+  SET_DISPLAY (FRAME_LEXICAL_DEPTH (dynamic_link));\
   }
 #endif
 
 #define CLOSE_FRAME {\
   ACTIVATION_RECORD *act = FACT (A68_FP);\
   A68_FP = DYNAMIC_LINK (act);\
+  SET_DISPLAY (FRAME_DEPTH (act));\
   }
 
 #endif
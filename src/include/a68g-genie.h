@@ -129,6 +129,38 @@
 #define MATRIX_OFFSET(a, t1, t2)\
   ((LWB (t1) * SPAN (t1) - SHIFT (t1) + LWB (t2) * SPAN (t2) - SHIFT (t2) + SLICE_OFFSET (a)) * ELEM_SIZE (a) + FIELD_OFFSET (a))
 
+// A packed block of a [] CHAR holds one byte per character, all initialised.
+// Descriptors and names do not change, so offsets in it are those of A68_CHARs.
+
+#define PACKED_ROW(z) (IS_IN_HEAP (z) && STATUS_TEST (REF_HANDLE (z), PACKED_MASK))
+#define PACKED_ADDRESS(z, k) (&(REF_POINTER (z)[(REF_OFFSET (z) + (k)) / SIZE_ALIGNED (A68_CHAR)]))
+#define PACKABLE_CHAR(ch) (INITIALISED (ch) && VALUE (ch) >= 0 && VALUE (ch) <= (int) UCHAR_MAX)
+#define CHAR_AT(packed, q) ((packed) ? (int) *(q) : VALUE ((A68_CHAR *) (q)))
+
+// Unpack the block of row "z" with descriptor "a", "t" before its elements are addressed as A68_CHARs
+
+#define UNPACK_ROW(p, a, t, z)\
+  if (PACKED_ROW (&ARRAY (a))) {\
+    unpack_row ((p), &ARRAY (a));\
+    GET_DESCRIPTOR ((a), (t), (z));\
+  }
+
+// Copy the element that name "z" refers to, in a block that may be packed, to "dst"
+
+#define GET_ROW_ELEMENT(dst, z, size)\
+  if (PACKED_ROW (z)) {\
+    STATUS ((A68_CHAR *) (dst)) = INIT_MASK;\
+    VALUE ((A68_CHAR *) (dst)) = *PACKED_ADDRESS ((z), 0);\
+  } else {\
+    MOVE ((dst), ADDRESS (z), (size));\
+  }
+
+#define PUSH_ROW_ELEMENT(p, z, size) {\
+  BYTE_T *_sp_ = STACK_TOP;\
+  INCREMENT_STACK_POINTER ((p), (int) (size));\
+  GET_ROW_ELEMENT (_sp_, (z), (size));\
+  }
+
 // Execution
 
 #define EXECUTE_UNIT_2(p, dest) {\
@@ -152,6 +184,10 @@
 
 #define DEFAULT_PREEMPTIVE 0.8
 
+// Grow the heap when collections take more than this share of run time
+
+#define DEFAULT_GC_SHARE 0.2
+
 // Save a handle from the GC
 
 #define BLOCK_GC_HANDLE(z) {\
@@ -377,10 +413,10 @@ extern PROP_T genie_assignation (NODE_T *);
 extern PROP_T genie_assignation_quick (NODE_T * p);
 extern PROP_T genie_call (NODE_T *);
 extern PROP_T genie_cast (NODE_T *);
-extern PROP_T genie_closed (volatile NODE_T *);
+extern PROP_T genie_closed (NODE_T *);
 extern PROP_T genie_coercion (NODE_T *);
 extern PROP_T genie_collateral (NODE_T *);
-extern PROP_T genie_conditional (volatile NODE_T *);
+extern PROP_T genie_conditional (NODE_T *);
 extern PROP_T genie_constant (NODE_T *);
 extern PROP_T genie_denotation (NODE_T *);
 extern PROP_T genie_deproceduring (NODE_T *);
@@ -392,7 +428,7 @@ extern PROP_T genie_dereferencing (NODE_T *);
 extern PROP_T genie_dereferencing_quick (NODE_T *);
 extern PROP_T genie_dyadic (NODE_T *);
 extern PROP_T genie_dyadic_quick (NODE_T *);
-extern PROP_T genie_enclosed (volatile NODE_T *);
+extern PROP_T genie_enclosed (NODE_T *);
 extern PROP_T genie_field_selection (NODE_T *);
 extern PROP_T genie_format_text (NODE_T *);
 extern PROP_T genie_formula (NODE_T *);
@@ -401,9 +437,9 @@ extern PROP_T genie_identifier (NODE_T *);
 extern PROP_T genie_identifier_standenv (NODE_T *);
 extern PROP_T genie_identifier_standenv_proc (NODE_T *);
 extern PROP_T genie_identity_relation (NODE_T *);
-extern PROP_T genie_int_case (volatile NODE_T *);
-extern PROP_T genie_loop (volatile NODE_T *);
-extern PROP_T genie_loop (volatile NODE_T *);
+extern PROP_T genie_int_case (NODE_T *);
+extern PROP_T genie_loop (NODE_T *);
+extern PROP_T genie_loop (NODE_T *);
 extern PROP_T genie_monadic (NODE_T *);
 extern PROP_T genie_nihil (NODE_T *);
 extern PROP_T genie_or_function (NODE_T *);
@@ -419,7 +455,7 @@ extern PROP_T genie_selection_value_quick (NODE_T *);
 extern PROP_T genie_skip (NODE_T *);
 extern PROP_T genie_slice_name_quick (NODE_T *);
 extern PROP_T genie_slice (NODE_T *);
-extern PROP_T genie_united_case (volatile NODE_T *);
+extern PROP_T genie_united_case (NODE_T *);
 extern PROP_T genie_uniting (NODE_T *);
 extern PROP_T genie_unit (NODE_T *);
 extern PROP_T genie_voiding_assignation_constant (NODE_T *);
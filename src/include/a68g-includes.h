@@ -180,6 +180,10 @@
 #include <sys/ioctl.h>
 #endif
 
+#if defined (HAVE_SYS_MMAN_H)
+#include <sys/mman.h>
+#endif
+
 #if defined (HAVE_SYS_RESOURCE_H)
 #include <sys/resource.h>
 #endif
@@ -39,8 +39,11 @@
 #define STANDENV_PROC_MASK        ((STATUS_MASK_T) 0x00000800)
 #define COLOUR_MASK               ((STATUS_MASK_T) 0x00001000)
 #define MODULAR_MASK              ((STATUS_MASK_T) 0x00002000)
+#define OLD_MASK                  ((STATUS_MASK_T) 0x00002000)
 #define OPTIMAL_MASK              ((STATUS_MASK_T) 0x00004000)
+#define PINNED_MASK               ((STATUS_MASK_T) 0x00004000)
 #define SERIAL_MASK               ((STATUS_MASK_T) 0x00008000)
+#define PACKED_MASK               ((STATUS_MASK_T) 0x00008000)
 #define CROSS_REFERENCE_MASK      ((STATUS_MASK_T) 0x00010000)
 #define TREE_MASK                 ((STATUS_MASK_T) 0x00020000)
 #define CODE_MASK                 ((STATUS_MASK_T) 0x00040000)
@@ -52,6 +52,7 @@
 #define NO_PROCEDURE ((A68_PROCEDURE *) NULL)
 #define NO_REAL ((REAL_T *) NULL)
 #define NO_REFINEMENT ((REFINEMENT_T *) NULL)
+#define NO_REGEX_CACHE ((REGEX_CACHE_T *) NULL)
 #define NO_REGMATCH ((regmatch_t *) NULL)
 #define NO_SCOPE ((SCOPE_T *) NULL)
 #define NO_SOID ((SOID_T *) NULL)
@@ -71,6 +72,7 @@ static const A68_HANDLE nil_handle = {
   INIT_MASK,
   NO_BYTE,
   0,
+  0,
   NO_MOID,
   NO_HANDLE,
   NO_HANDLE
@@ -24,10 +24,15 @@
 
 extern BOOL_T constant_unit (NODE_T *);
 extern BOOL_T folder_mode (MOID_T *);
+extern BOOL_T load_executable (void);
+extern BOOL_T plugin_cache_fetch (char *);
+extern void build_executable (void);
 extern void build_script (void);
 extern void compiler (FILE_T);
 extern void load_script (void);
+extern void plugin_cache_store (char *);
 extern void push_unit (NODE_T *);
+extern void remove_executable_dir (void);
 extern void rewrite_script_source (void);
 
 // Library for code generator
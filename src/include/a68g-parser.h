@@ -70,6 +70,8 @@ extern PACK_T *absorb_union_pack (PACK_T *);
 extern PACK_T *new_pack (void);
 extern TABLE_T *find_level (NODE_T *, int);
 extern TABLE_T *new_symbol_table (TABLE_T *);
+extern TAG_INDEX_T *tag_index_first (TABLE_T *, int, char *);
+extern TAG_INDEX_T *tag_index_next (TAG_INDEX_T *);
 extern TAG_T *add_tag (TABLE_T *, int, NODE_T *, MOID_T *, int);
 extern TAG_T *find_tag_global (TABLE_T *, int, char *);
 extern TAG_T *find_tag_local (TABLE_T *, int, char *);
@@ -110,7 +112,9 @@ extern void get_max_simplout_size (NODE_T *);
 extern void get_refinements (void);
 extern void ignore_superfluous_semicolons (NODE_T *);
 extern void init_before_tokeniser (void);
+extern void index_tag (TAG_T *, int);
 extern void init_parser (void);
+extern void init_tag_index (void);
 extern void jumps_from_procs (NODE_T * p);
 extern void make_moid_list (MODULE_T *);
 extern void make_special_mode (MOID_T **, int);
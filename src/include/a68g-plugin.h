@@ -71,6 +71,7 @@ extern BOOL_T basic_indexer (NODE_T *);
 extern BOOL_T basic_mode (MOID_T *);
 extern BOOL_T basic_mode_non_row (MOID_T *);
 extern BOOL_T basic_monadic_formula (NODE_T *);
+extern BOOL_T basic_selection (NODE_T *);
 extern BOOL_T basic_serial (NODE_T *, int);
 extern BOOL_T basic_slice (NODE_T *);
 extern BOOL_T basic_unit (NODE_T *);
@@ -119,6 +120,7 @@ extern char *make_unic_name (char *, char *, char *, char *);
 extern char *moid_with_name (char *, MOID_T *, char *);
 extern DEC_T *add_declaration (DEC_T **, char *, int, char *);
 extern DEC_T *add_identifier (DEC_T **, int, char *);
+extern NODE_T *selection_root (NODE_T *, ADDR_T *, char **);
 extern NODE_T *stems_from (NODE_T *, int);
 extern void comment_source (NODE_T *, FILE_T);
 extern void constant_folder (NODE_T *, FILE_T, int);
@@ -67,11 +67,14 @@ extern A68_REF empty_string (NODE_T *);
 extern A68_REF genie_make_row (NODE_T *, MOID_T *, int, ADDR_T);
 extern A68_REF genie_store (NODE_T *, MOID_T *, A68_REF *, A68_REF *);
 extern A68_REF heap_generator (NODE_T *, MOID_T *, int);
+extern A68_REF packed_string (NODE_T *, int, BYTE_T **);
 extern A68_REF tmp_to_a68_string (NODE_T *, char *);
 extern ADDR_T calculate_internal_index (A68_TUPLE *, int);
+extern BOOL_T char_sweep (A68_ARRAY *, A68_TUPLE *, BYTE_T **, int *);
 extern BOOL_T close_device (NODE_T *, A68_FILE *);
 extern BOOL_T genie_int_case_unit (NODE_T *, int, int *);
 extern BOOL_T increment_internal_index (A68_TUPLE *, int);
+extern BOOL_T packable_chars (A68_ARRAY *, A68_TUPLE *);
 extern char *a_to_c_string (NODE_T *, char *, A68_REF);
 extern char *propagator_name (PROP_PROC * p);
 extern FILE *a68_fopen (char *, char *, char *);
@@ -89,18 +92,23 @@ extern REAL_T seconds (void);
 extern REAL_T ten_up (int);
 extern ssize_t io_read_conv (FILE_T, void *, size_t);
 extern ssize_t io_read (FILE_T, void *, size_t);
+extern ssize_t io_read_some (FILE_T, void *, size_t);
 extern ssize_t io_write_conv (FILE_T, const void *, size_t);
 extern ssize_t io_write (FILE_T, const void *, size_t);
-extern unt heap_available (void);
+extern ADDR_T heap_available (void);
 extern void a68_div_complex (A68_REAL *, A68_REAL *, A68_REAL *);
 extern void a68_exit (int);
 extern void a68_exp_complex (A68_REAL *, A68_REAL *);
 extern void change_breakpoints (NODE_T *, unt, int, BOOL_T *, char *);
 extern void change_masks (NODE_T *, unt, BOOL_T);
+extern void copy_chars (BYTE_T *, BOOL_T, int, A68_ARRAY *, A68_TUPLE *);
 extern void colour_object (BYTE_T *, MOID_T *);
 extern void deltagammainc (REAL_T *, REAL_T *, REAL_T, REAL_T, REAL_T, REAL_T);
+extern void exchange_blocks (A68_HANDLE *, A68_HANDLE *);
 extern void exit_genie (NODE_T *, int);
+extern void free_regex_cache (void);
 extern void gc_heap (NODE_T *, ADDR_T);
+extern void gc_heap_minor (NODE_T *, ADDR_T);
 extern void genie_call_event_routine (NODE_T *, MOID_T *, A68_PROCEDURE *, ADDR_T, ADDR_T);
 extern void genie_call_operator (NODE_T *, ADDR_T);
 extern void genie_call_procedure (NODE_T *, MOID_T *, MOID_T *, MOID_T *, A68_PROCEDURE *, ADDR_T, ADDR_T);
@@ -114,8 +122,8 @@ extern void genie_init_rng (void);
 extern void genie_preprocess (NODE_T *, int *, void *);
 extern void genie_push_undefined (NODE_T *, MOID_T *);
 extern void genie_read_standard (NODE_T *, MOID_T *, BYTE_T *, A68_REF);
-extern void genie_serial_clause (NODE_T *, jmp_buf *);
-extern void genie_serial_units (NODE_T *, NODE_T **, jmp_buf *, ADDR_T);
+extern void genie_serial_clause (NODE_T *);
+extern BOOL_T genie_serial_units (NODE_T *, NODE_T **, ADDR_T);
 extern void genie_string_to_value (NODE_T *, MOID_T *, BYTE_T *, A68_REF);
 extern void genie_subscript (NODE_T *, A68_TUPLE **, INT_T *, NODE_T **);
 extern void genie_value_to_string (NODE_T *, MOID_T *, BYTE_T *, int);
@@ -132,6 +140,7 @@ extern void print_item (NODE_T *, FILE_T, BYTE_T *, MOID_T *);
 extern void single_step (NODE_T *, unt);
 extern void skip_nl_ff (NODE_T *, int *, A68_REF);
 extern void stack_dump (FILE_T, ADDR_T, int, int *);
+extern void unpack_row (NODE_T *, A68_REF *);
 extern void value_sign_error (NODE_T *, MOID_T *, A68_REF);
 extern void where_in_source (FILE_T, NODE_T *);
 
@@ -163,6 +172,8 @@ extern GPROC genie_add_long_bytes;
 extern GPROC genie_add_mp_int;
 extern GPROC genie_add_real;
 extern GPROC genie_add_string;
+extern GPROC genie_allocation_collections;
+extern GPROC genie_allocation_rate;
 extern GPROC genie_and_bits;
 extern GPROC genie_and_bool;
 extern GPROC genie_argc;
@@ -291,6 +302,9 @@ extern GPROC genie_garbage_collections;
 extern GPROC genie_garbage_freed;
 extern GPROC genie_garbage_refused;
 extern GPROC genie_garbage_seconds;
+extern GPROC genie_garbage_survival;
+extern GPROC genie_garbage_tenured;
+extern GPROC genie_garbage_threshold;
 extern GPROC genie_gc_heap;
 extern GPROC genie_ge_bits;
 extern GPROC genie_ge_bytes;
@@ -390,11 +404,14 @@ extern GPROC genie_lt_long_bytes;
 extern GPROC genie_lt_real;
 extern GPROC genie_lt_string;
 extern GPROC genie_make_term;
+extern GPROC genie_major_collections;
 extern GPROC genie_max_abs_char;
 extern GPROC genie_max_bits;
 extern GPROC genie_max_int;
 extern GPROC genie_max_real;
 extern GPROC genie_min_real;
+extern GPROC genie_minor_collections;
+extern GPROC genie_minor_garbage_freed;
 extern GPROC genie_minusab_complex;
 extern GPROC genie_minusab_int;
 extern GPROC genie_minusab_mp_int;
@@ -512,6 +529,8 @@ extern GPROC genie_realpath;
 extern GPROC genie_real_shorths;
 extern GPROC genie_real_width;
 extern GPROC genie_re_complex;
+extern GPROC genie_regex_cache_hits;
+extern GPROC genie_regex_cache_misses;
 extern GPROC genie_reidf_possible;
 extern GPROC genie_repr_char;
 extern GPROC genie_reset;
@@ -620,6 +639,8 @@ extern GPROC genie_up_sema;
 #endif
 
 #if defined (BUILD_HTTP)
+extern GPROC genie_handle_capacity;
+extern GPROC genie_heap_capacity;
 extern GPROC genie_http_content;
 extern GPROC genie_tcp_request;
 #endif
@@ -656,26 +677,41 @@ extern GPROC genie_pq_backendpid;
 extern GPROC genie_pq_cmdstatus;
 extern GPROC genie_pq_cmdtuples;
 extern GPROC genie_pq_connectdb;
+extern GPROC genie_pq_consumeinput;
 extern GPROC genie_pq_db;
+extern GPROC genie_pq_enterpipelinemode;
 extern GPROC genie_pq_errormessage;
 extern GPROC genie_pq_exec;
+extern GPROC genie_pq_exitpipelinemode;
 extern GPROC genie_pq_fformat;
 extern GPROC genie_pq_finish;
+extern GPROC genie_pq_flush;
 extern GPROC genie_pq_fname;
 extern GPROC genie_pq_fnumber;
+extern GPROC genie_pq_getcolumn;
+extern GPROC genie_pq_getintcolumn;
 extern GPROC genie_pq_getisnull;
+extern GPROC genie_pq_getrealcolumn;
+extern GPROC genie_pq_getresult;
+extern GPROC genie_pq_getrow;
 extern GPROC genie_pq_getvalue;
 extern GPROC genie_pq_host;
+extern GPROC genie_pq_isbusy;
+extern GPROC genie_pq_nextresult;
 extern GPROC genie_pq_nfields;
 extern GPROC genie_pq_ntuples;
 extern GPROC genie_pq_options;
 extern GPROC genie_pq_parameterstatus;
 extern GPROC genie_pq_pass;
+extern GPROC genie_pq_pipelinesync;
 extern GPROC genie_pq_port;
 extern GPROC genie_pq_protocolversion;
 extern GPROC genie_pq_reset;
 extern GPROC genie_pq_resulterrormessage;
+extern GPROC genie_pq_sendquery;
 extern GPROC genie_pq_serverversion;
+extern GPROC genie_pq_setnonblocking;
+extern GPROC genie_pq_singlerowmode;
 extern GPROC genie_pq_socket;
 extern GPROC genie_pq_tty;
 extern GPROC genie_pq_user;
@@ -712,6 +748,8 @@ extern PROP_T genie_parallel (NODE_T *);
 extern BOOL_T is_main_thread (void);
 extern void genie_abend_all_threads (NODE_T *, jmp_buf *, NODE_T *);
 extern void genie_set_exit_from_threads (int);
+extern void release_thread (void);
+extern void resume_thread (void);
 #define SAME_THREAD(p, q) (pthread_equal((p), (q)) != 0)
 #define OTHER_THREAD(p, q) (pthread_equal((p), (q)) == 0)
 #endif
@@ -46,6 +46,7 @@
 
 extern A68_ROW matrix_to_row (NODE_T *, gsl_matrix *);
 extern A68_ROW vector_to_row (NODE_T *, gsl_vector *);
+extern BOOL_T is_torrix_fusable (NODE_T *);
 extern gsl_matrix_complex *pop_matrix_complex (NODE_T *, BOOL_T);
 extern gsl_matrix *compute_pca_cv (NODE_T *, gsl_vector **, gsl_matrix *);
 extern gsl_matrix *compute_pca_svd (NODE_T *, gsl_vector **, gsl_matrix *);
@@ -56,6 +57,7 @@ extern gsl_matrix *pop_matrix (NODE_T *, BOOL_T);
 extern gsl_permutation *pop_permutation (NODE_T *, BOOL_T);
 extern gsl_vector_complex *pop_vector_complex (NODE_T *, BOOL_T);
 extern gsl_vector *pop_vector (NODE_T *, BOOL_T);
+extern PROP_T genie_formula_torrix (NODE_T *);
 extern REAL_T matrix_norm (gsl_matrix *);
 extern void compute_pseudo_inverse (NODE_T *, gsl_matrix **, gsl_matrix *, REAL_T);
 extern void print_matrix (gsl_matrix *, unt);
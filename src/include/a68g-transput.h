@@ -24,6 +24,8 @@
 
 #if (A68_LEVEL >= 3)
 extern char *long_sub_whole_double (NODE_T *, DOUBLE_NUM_T, int);
+extern char *sub_fixed_real (NODE_T *, REAL_T, int, int, int);
+extern void standardise_real (REAL_T, int, int, int *);
 #endif
 
 extern BOOL_T convert_radix_mp (NODE_T *, MP_T *, int, int, MOID_T *, MP_T *, MP_T *);
@@ -55,12 +57,15 @@ extern int get_transput_buffer_index (int);
 extern int get_transput_buffer_size (int);
 extern int get_unblocked_transput_buffer (NODE_T *);
 extern int store_file_entry (NODE_T *, FILE_T, char *, BOOL_T);
+extern ssize_t read_buffer_bytes (FILE_T, int, void *, size_t);
+extern size_t get_read_buffer_reserve (int);
 extern void add_a_string_transput_buffer (NODE_T *, int, BYTE_T *);
 extern void add_chars_transput_buffer (NODE_T *, int, int, char *);
 extern void add_string_from_stack_transput_buffer (NODE_T *, int);
 extern void add_string_transput_buffer (NODE_T *, int, char *);
 extern void end_of_file_error (NODE_T * p, A68_REF ref_file);
 extern void enlarge_transput_buffer (NODE_T *, int, int);
+extern void flush_write_buffer (int);
 extern void format_error (NODE_T *, A68_REF, char *);
 extern void long_standardise (NODE_T *, MP_T *, int, int, int, int *);
 extern void on_event_handler (NODE_T *, A68_PROCEDURE, A68_REF);
@@ -71,6 +76,7 @@ extern void plusto_transput_buffer (NODE_T *, char, int);
 extern void read_insertion (NODE_T *, A68_REF);
 extern void read_sound (NODE_T *, A68_REF, A68_SOUND *);
 extern void reset_transput_buffer (int);
+extern void rewind_read_buffer (FILE_T, int);
 extern void set_default_event_procedure (A68_PROCEDURE *);
 extern void set_default_event_procedures (A68_FILE *);
 extern void set_transput_buffer_index (int, int);
@@ -80,6 +86,8 @@ extern void transput_error (NODE_T *, A68_REF, MOID_T *);
 extern void unchar_scanner (NODE_T *, A68_FILE *, char);
 extern void value_error (NODE_T *, MOID_T *, A68_REF);
 extern void write_insertion (NODE_T *, A68_REF, MOOD_T);
+extern void write_buffer_bytes (FILE_T, int, void *, size_t);
+extern void write_buffer_string (FILE_T, int, char *);
 extern void write_purge_buffer (NODE_T *, A68_REF, int);
 extern void write_sound (NODE_T *, A68_REF, A68_SOUND *);
 
@@ -70,6 +70,7 @@ typedef struct PROP_T PROP_T;
 typedef struct REFINEMENT_T REFINEMENT_T;
 typedef struct SOID_T SOID_T;
 typedef struct TABLE_T TABLE_T;
+typedef struct TAG_INDEX_T TAG_INDEX_T;
 typedef struct TAG_T TAG_T;
 typedef struct TOKEN_T TOKEN_T;
 typedef unt FILE_T, MOOD_T;
@@ -96,7 +97,7 @@ struct ACTIVATION_RECORD
   NODE_T *node;
   jmp_buf *jump_stat;
   BOOL_T proc_frame;
-  int frame_no, frame_level, parameter_level;
+  int frame_no, frame_level, frame_depth, parameter_level;
 #if defined (BUILD_PARALLEL_CLAUSE)
   pthread_t thread_id;
 #endif
@@ -160,8 +161,8 @@ struct MODES_T
 struct OPTIONS_T
 {
   OPTION_LIST_T *list;
-  BOOL_T backtrace, brackets, check_only, clock, cross_reference, debug, compile, compile_check, keep, fold, license, moid_listing, object_listing, portcheck, pragmat_sema, pretty, reductions, regression_test, run, rerun, run_script, source_listing, standard_prelude_listing, statistics_listing, strict, stropping, trace, tree_listing, unused, verbose, version, no_warnings, quiet;
-  int time_limit, opt_level, indent;
+  BOOL_T backtrace, brackets, check_only, clock, cross_reference, debug, compile, compile_check, executable, keep, fold, license, map_input, moid_listing, object_listing, plugin_cache, portcheck, pragmat_sema, pretty, reductions, regression_test, run, rerun, run_script, source_listing, standard_prelude_listing, statistics_listing, strict, stropping, trace, tree_listing, unused, verbose, version, no_warnings, quiet;
+  int time_limit, opt_level, indent, read_buffer, write_buffer;
   STATUS_MASK_T nodemask;
 };
 
@@ -204,7 +205,7 @@ struct GINFO_T
   MOID_T *partial_proc, *partial_locale;
   NODE_T *parent;
   char *compile_name;
-  int level, argsize, size, compile_node;
+  int level, depth, argsize, size, compile_node;
   void *constant;
 };
 
@@ -262,8 +263,8 @@ struct LINE_T
 
 struct TABLE_T
 {
-  int num, level, nest, attribute;
-  BOOL_T initialise_frame, initialise_anon, proc_ops;
+  int num, level, depth, nest, attribute;
+  BOOL_T initialise_frame, initialise_anon, proc_ops, frameless;
   ADDR_T ap_increment;
   TABLE_T *previous, *outer;
   TAG_T *identifiers, *operators, *priority, *indicants, *labels, *anonymous;
@@ -286,6 +287,16 @@ struct TAG_T
 };
 #define NO_TAG ((TAG_T *) NULL)
 
+struct TAG_INDEX_T
+{
+  TABLE_T *symbol_table;
+  int attribute;
+  char *text;
+  TAG_T *tag;
+  TAG_INDEX_T *next;
+};
+#define NO_TAG_INDEX ((TAG_INDEX_T *) NULL)
+
 struct TOKEN_T
 {
   char *text;
@@ -298,12 +309,14 @@ struct TOKEN_T
 //! A REF into the HEAP points at a HANDLE.
 //! The HANDLE points at the actual object in the HEAP.
 //! Garbage collection modifies HANDLEs, but not REFs.
+//! A STRING body that has spare capacity records in "used" how much of it
+//! is in use, so appends can grow it in place; "used" is 0 otherwise.
 
 struct A68_HANDLE
 {
   STATUS_MASK_T status;
   BYTE_T *pointer;
-  int size;
+  int size, used;
   MOID_T *type;
   A68_HANDLE *next, *previous;
 } ALIGNED;
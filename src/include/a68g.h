@@ -145,8 +145,10 @@ extern void announce_phase (char *);
 extern void apropos (FILE_T, char *, char *);
 extern void bufcat (char *, char *, int);
 extern void bufcpy (char *, char *, int);
+extern void default_heap_limit (void);
 extern void default_mem_sizes (int);
 extern void discard_heap (void);
+extern void flush_write_buffers (void);
 extern void free_file_entries (void);
 extern void free_syntax_tree (NODE_T *);
 extern void get_stack_size (void);